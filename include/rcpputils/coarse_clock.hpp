@@ -0,0 +1,199 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file coarse_clock.hpp
+ * \brief Cheap steady clocks trading resolution for speed.
+ */
+
+#ifndef RCPPUTILS__COARSE_CLOCK_HPP_
+#define RCPPUTILS__COARSE_CLOCK_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "rcpputils/visibility_control.hpp"
+
+namespace rcpputils
+{
+
+/// A steady clock with a resolution of a few milliseconds, which is cheaper to read.
+/**
+ * On Linux the clock reads `CLOCK_MONOTONIC_COARSE`, which returns the time of the last
+ * scheduler tick without reading a hardware counter.
+ * Its time points share the epoch of std::chrono::steady_clock, and typically lag it by up to
+ * resolution(); on tickless kernels the lag may briefly be longer, until the next tick.
+ *
+ * Elsewhere the clock falls back to std::chrono::steady_clock.
+ *
+ * This class satisfies the TrivialClock requirements of the C++ standard.
+ */
+class coarse_clock
+{
+public:
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<coarse_clock>;
+
+  static constexpr bool is_steady = true;
+
+  /// Get the current time.
+  RCPPUTILS_PUBLIC
+  static time_point
+  now() noexcept;
+
+  /// Get the interval at which the clock advances, which is also its typical staleness.
+  RCPPUTILS_PUBLIC
+  static duration
+  resolution() noexcept;
+};
+
+namespace detail
+{
+// The time published by the cached_clock ticker, alone on its cache line so that the ticker's
+// stores do not invalidate the data of unrelated readers.
+struct alignas(64) cached_clock_state
+{
+  // Nanoseconds since the steady_clock epoch, or 0 while no ticker runs.
+  std::atomic<std::int64_t> nanoseconds{0};
+  // The ticker period in nanoseconds, or 0 while no ticker runs.
+  std::atomic<std::int64_t> period{0};
+  // The latest time returned by cached_clock::now(), in nanoseconds since the steady_clock epoch.
+  std::atomic<std::int64_t> high_water{0};
+};
+
+RCPPUTILS_PUBLIC
+extern cached_clock_state cached_clock_time;
+}  // namespace detail
+
+/// A steady clock whose value is published periodically by a background thread.
+/**
+ * Reading the clock costs two relaxed atomic loads, plus a store only the first time a new
+ * value is read, which makes it suitable for very frequent, low resolution timestamps such as
+ * statistics windows or log throttling.
+ *
+ * The clock is opt-in: it only advances while a cached_clock::ticker exists, which updates the
+ * published time from std::chrono::steady_clock once per period.
+ * While no ticker exists, now() falls back to std::chrono::steady_clock, recording each value so
+ * that the clock does not go backwards once a ticker starts.
+ * Its time points share the epoch of std::chrono::steady_clock, and lag it by up to
+ * max_staleness() plus the scheduling latency of the ticker thread.
+ *
+ * \code
+ * int main()
+ * {
+ *   rcpputils::cached_clock::ticker ticker(std::chrono::milliseconds(1));
+ *   ...
+ *   const auto stamp = rcpputils::cached_clock::now();
+ * }
+ * \endcode
+ */
+class cached_clock
+{
+public:
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<cached_clock>;
+
+  static constexpr bool is_steady = true;
+
+  /// Get the most recently published time.
+  static time_point
+  now() noexcept
+  {
+    std::int64_t value = detail::cached_clock_time.nanoseconds.load(std::memory_order_relaxed);
+    if (0 == value) {
+      value = std::chrono::duration_cast<duration>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    // The published time lags steady_clock, so when a ticker starts it may be older than a time
+    // read directly just before; never return less than a previously returned time.
+    std::int64_t last = detail::cached_clock_time.high_water.load(std::memory_order_relaxed);
+    while (last < value &&
+      !detail::cached_clock_time.high_water.compare_exchange_weak(
+        last, value, std::memory_order_relaxed))
+    {
+    }
+    return time_point(duration(last < value ? value : last));
+  }
+
+  /// Whether a ticker is publishing the time.
+  static bool
+  is_running() noexcept
+  {
+    return 0 != detail::cached_clock_time.period.load(std::memory_order_relaxed);
+  }
+
+  /// Get the interval at which the clock advances.
+  /**
+   * \return The ticker period, or the resolution of std::chrono::steady_clock without a ticker.
+   */
+  RCPPUTILS_PUBLIC
+  static duration
+  resolution() noexcept;
+
+  /// Get the nominal bound on how far the clock lags std::chrono::steady_clock.
+  /**
+   * \return The ticker period, or zero without a ticker.
+   */
+  RCPPUTILS_PUBLIC
+  static duration
+  max_staleness() noexcept;
+
+  /// Publishes the time for cached_clock from a background thread for as long as it exists.
+  /**
+   * At most one ticker may exist at a time.
+   */
+  class ticker
+  {
+public:
+    /// Start publishing the time every `period`.
+    /**
+     * The time is published once before the constructor returns.
+     *
+     * \param[in] period the interval between updates
+     * \throws std::invalid_argument if `period` is not positive
+     * \throws std::logic_error if another ticker exists
+     * \throws std::system_error if the thread cannot be started
+     */
+    RCPPUTILS_PUBLIC
+    explicit ticker(duration period = std::chrono::milliseconds(1));
+
+    /// Stop publishing the time, after which cached_clock falls back to steady_clock.
+    RCPPUTILS_PUBLIC
+    ~ticker();
+
+    ticker(const ticker &) = delete;
+    ticker & operator=(const ticker &) = delete;
+
+private:
+    void
+    run();
+
+    duration period_;
+    std::mutex mutex_;
+    std::condition_variable stop_requested_;
+    bool stop_{false};
+    std::thread thread_;
+  };
+};
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__COARSE_CLOCK_HPP_
@@ -0,0 +1,146 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file csv.hpp
+ * \brief Quote and escape aware tokenizer for comma separated values.
+ */
+
+#ifndef RCPPUTILS__CSV_HPP_
+#define RCPPUTILS__CSV_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rcpputils/visibility_control.hpp"
+
+namespace rcpputils
+{
+
+/// A single field of a CSV record, pointing into the input.
+struct csv_field
+{
+  /// Field contents, without enclosing quotes; escaped quotes are still doubled.
+  std::string_view value;
+  /// The quote character, meaningful only if `escaped` is true.
+  char quote;
+  /// Whether the field was enclosed in quotes.
+  bool quoted;
+  /// Whether `value` contains doubled quotes, which unescaping collapses.
+  bool escaped;
+
+  /// Append the unescaped field contents to `out`.
+  void
+  append_unescaped(std::string & out) const
+  {
+    if (!escaped) {
+      out.append(value);
+      return;
+    }
+    std::size_t begin = 0;
+    while (begin < value.size()) {
+      const std::size_t pos = value.find(quote, begin);
+      if (std::string_view::npos == pos) {
+        out.append(value.substr(begin));
+        break;
+      }
+      // Keep the first quote of each doubled pair.
+      out.append(value.substr(begin, pos + 1 - begin));
+      begin = pos + 2;
+    }
+  }
+
+  /// Get the unescaped field contents.
+  std::string
+  unescaped() const
+  {
+    std::string out;
+    out.reserve(value.size());
+    append_unescaped(out);
+    return out;
+  }
+};
+
+/// RFC 4180 style tokenizer for comma separated values.
+/**
+ * Fields are separated by a delimiter, records by `\n` or `\r\n`, and fields may be enclosed in
+ * quotes to contain delimiters, line breaks and doubled (escaped) quotes.
+ * Quotes are only expected at the start and end of a field, as in RFC 4180.
+ * Blank lines are skipped.
+ *
+ * The input is classified 64 bytes at a time into bitmasks of quotes, delimiters and line
+ * breaks using SSE2, AVX2 or NEON when the running CPU supports them.
+ * Quoted regions are then derived from the quote mask with a prefix XOR, so that delimiters and
+ * line breaks within quotes are discarded without examining bytes one by one.
+ *
+ * Records can be read either as views into the input, which never allocates once the output
+ * vector is large enough, or as unescaped copies.
+ */
+class csv_reader
+{
+public:
+  /// Construct a reader over `input`, which must outlive the reader and the fields it returns.
+  /**
+   * \param[in] input the CSV data
+   * \param[in] delimiter the field delimiter
+   * \param[in] quote the quote character
+   * \throws std::invalid_argument if delimiter and quote are equal or either is a line break
+   */
+  RCPPUTILS_PUBLIC
+  explicit csv_reader(std::string_view input, char delimiter = ',', char quote = '"');
+
+  /// Read the next record as views into the input.
+  /**
+   * \param[out] fields cleared and filled with the fields of the record
+   * \return true if a record was read, false at the end of the input.
+   */
+  RCPPUTILS_PUBLIC
+  bool
+  next_record(std::vector<csv_field> & fields);
+
+  /// Read the next record as unescaped copies.
+  /**
+   * Existing elements of `fields` are overwritten in place, reusing their buffers.
+   *
+   * \param[out] fields filled with the unescaped fields of the record
+   * \return true if a record was read, false at the end of the input.
+   */
+  RCPPUTILS_PUBLIC
+  bool
+  next_record(std::vector<std::string> & fields);
+
+private:
+  bool
+  next_block();
+
+  std::string_view input_;
+  char delimiter_;
+  char quote_;
+  // Offset of the block the pending structural characters belong to, and of the next block.
+  std::size_t block_start_{0};
+  std::size_t next_block_{0};
+  // Unquoted delimiters and line breaks of the current block which are yet to be consumed.
+  std::uint64_t pending_{0};
+  // All ones if the previous block ended inside quotes, zero otherwise.
+  std::uint64_t in_quotes_{0};
+  std::size_t field_start_{0};
+  bool done_{false};
+  std::vector<csv_field> scratch_;
+};
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__CSV_HPP_
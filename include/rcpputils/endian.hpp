@@ -19,18 +19,29 @@
  * can be deprecated in favor of the built-in functionality.
  *
  * Note: std::endian is targeted for C++20
+ *
+ * The header also provides byteswap() and conversions between the native byte order and big or
+ * little endian, for decoding and encoding serialized data, as well as vectorized byteswap_n()
+ * and convert_endian() for converting whole arrays.
  */
 
 #ifndef RCPPUTILS__ENDIAN_HPP_
 #define RCPPUTILS__ENDIAN_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "rcpputils/visibility_control.hpp"
+
 // TODO(anyone) replace this macro when the appropriate C++20 value lands.
 #if !defined(RCPPUTILS_NO_STD_ENDIAN) && (__cplusplus <= 201703L)
 #define RCPPUTILS_NO_STD_ENDIAN
 #endif
 
 #if !defined(RCPPUTILS_NO_STD_ENDIAN)
-#include <type_traits>
 namespace rcpputils
 {
 using std::endian;
@@ -69,4 +80,267 @@ enum class endian
 };
 }  // namespace rcpputils
 #endif  // RCPPUTILS_HAVE_STD_ENDIAN
+
+#if defined(__has_builtin)
+#  if __has_builtin(__builtin_bit_cast)
+#    define RCPPUTILS_HAVE_BUILTIN_BIT_CAST 1
+#  endif
+#endif
+
+namespace rcpputils
+{
+namespace detail
+{
+template<typename T>
+constexpr T
+byteswap_unsigned(T value) noexcept
+{
+  static_assert(std::is_unsigned_v<T>, "byteswap_unsigned requires an unsigned type");
+  if constexpr (sizeof(T) == 1) {
+    return value;
+#if defined(__GNUC__) || defined(__clang__)
+  } else if constexpr (sizeof(T) == 2) {
+    return __builtin_bswap16(value);
+  } else if constexpr (sizeof(T) == 4) {
+    return __builtin_bswap32(value);
+  } else if constexpr (sizeof(T) == 8) {
+    return __builtin_bswap64(value);
+#endif
+  } else {
+    // Compilers recognize this loop and emit a single byte swap instruction.
+    T result = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      result = static_cast<T>((result << 8) | ((value >> (8 * i)) & 0xffu));
+    }
+    return result;
+  }
+}
+
+template<typename T>
+constexpr void
+check_byteswap_type() noexcept
+{
+  static_assert(
+    std::is_arithmetic_v<T> || std::is_enum_v<T>,
+    "byte swapping requires an integral, floating point or enumeration type");
+  static_assert(
+    sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+    "byte swapping requires a type of 1, 2, 4 or 8 bytes");
+}
+
+template<std::size_t Size>
+struct unsigned_of_size;
+
+template<>
+struct unsigned_of_size<1> {using type = std::uint8_t;};
+
+template<>
+struct unsigned_of_size<2> {using type = std::uint16_t;};
+
+template<>
+struct unsigned_of_size<4> {using type = std::uint32_t;};
+
+template<>
+struct unsigned_of_size<8> {using type = std::uint64_t;};
+
+// std::bit_cast is C++20; the builtin makes the conversion constexpr where it is available.
+template<typename ToT, typename FromT>
+#if defined(RCPPUTILS_HAVE_BUILTIN_BIT_CAST)
+constexpr
+#endif
+ToT
+bit_cast(const FromT & value) noexcept
+{
+  static_assert(sizeof(ToT) == sizeof(FromT), "bit_cast requires types of the same size");
+#if defined(RCPPUTILS_HAVE_BUILTIN_BIT_CAST)
+  return __builtin_bit_cast(ToT, value);
+#else
+  ToT result;
+  std::memcpy(&result, &value, sizeof(ToT));
+  return result;
+#endif
+}
+}  // namespace detail
+
+/// Reverse the bytes of an integral, floating point or enumeration value.
+/**
+ * This is constexpr for integral and enumeration types, and for floating point types where the
+ * compiler provides `__builtin_bit_cast`.
+ *
+ * A byte swapped floating point value may be a signaling NaN, which some platforms silently
+ * change when loading it into a floating point register, so it should be written to or read from
+ * memory directly rather than used in arithmetic.
+ *
+ * \param[in] value the value to swap
+ * \return The value with its bytes in reverse order.
+ */
+template<typename T>
+constexpr T
+byteswap(T value) noexcept
+{
+  detail::check_byteswap_type<T>();
+  if constexpr (std::is_enum_v<T>) {
+    using underlying_type = std::make_unsigned_t<std::underlying_type_t<T>>;
+    return static_cast<T>(detail::byteswap_unsigned(static_cast<underlying_type>(value)));
+  } else if constexpr (sizeof(T) == 1) {
+    return value;
+  } else if constexpr (std::is_integral_v<T>) {
+    return static_cast<T>(detail::byteswap_unsigned(static_cast<std::make_unsigned_t<T>>(value)));
+  } else {
+    using unsigned_type = typename detail::unsigned_of_size<sizeof(T)>::type;
+    return detail::bit_cast<T>(
+      detail::byteswap_unsigned(detail::bit_cast<unsigned_type>(value)));
+  }
+}
+
+/// Convert a value from the native byte order to big endian.
+/**
+ * This is a no-op on big endian platforms.
+ * \sa byteswap()
+ */
+template<typename T>
+constexpr T
+to_big(T value) noexcept
+{
+  detail::check_byteswap_type<T>();
+  if constexpr (endian::native == endian::big) {
+    return value;
+  } else {
+    return byteswap(value);
+  }
+}
+
+/// Convert a value from the native byte order to little endian.
+/**
+ * This is a no-op on little endian platforms.
+ * \sa byteswap()
+ */
+template<typename T>
+constexpr T
+to_little(T value) noexcept
+{
+  detail::check_byteswap_type<T>();
+  if constexpr (endian::native == endian::little) {
+    return value;
+  } else {
+    return byteswap(value);
+  }
+}
+
+/// Convert a value from big endian to the native byte order.
+/**
+ * This is a no-op on big endian platforms.
+ * \sa byteswap()
+ */
+template<typename T>
+constexpr T
+from_big(T value) noexcept
+{
+  return to_big(value);
+}
+
+/// Convert a value from little endian to the native byte order.
+/**
+ * This is a no-op on little endian platforms.
+ * \sa byteswap()
+ */
+template<typename T>
+constexpr T
+from_little(T value) noexcept
+{
+  return to_little(value);
+}
+
+namespace detail
+{
+// Reverse the bytes of each of `count` elements of `size` bytes, which must be 2, 4 or 8.
+// `src` and `dst` must either be equal or not overlap.
+RCPPUTILS_PUBLIC
+void
+byteswap_elements(
+  const void * src, void * dst, std::size_t size, std::size_t count) noexcept;
+}  // namespace detail
+
+/// Reverse the bytes of each element of an array, in place.
+/**
+ * This is equivalent to applying byteswap() to each element, but uses SIMD instructions
+ * selected at runtime (SSSE3 or AVX2 on x86, NEON on AArch64), with a scalar fallback.
+ * The array only needs the alignment of `T`, not of the vector registers.
+ *
+ * \param[inout] data the elements to swap
+ * \param[in] count the number of elements
+ */
+template<typename T>
+void
+byteswap_n(T * data, std::size_t count) noexcept
+{
+  detail::check_byteswap_type<T>();
+  if constexpr (sizeof(T) > 1) {
+    detail::byteswap_elements(data, data, sizeof(T), count);
+  }
+}
+
+/// Reverse the bytes of each element of an array, writing the result to another array.
+/**
+ * \param[in] src the elements to swap
+ * \param[out] dst the array to write to, which may be `src` but must not otherwise overlap it
+ * \param[in] count the number of elements
+ * \sa byteswap_n(T *, std::size_t)
+ */
+template<typename T>
+void
+byteswap_n(const T * src, T * dst, std::size_t count) noexcept
+{
+  detail::check_byteswap_type<T>();
+  if constexpr (sizeof(T) > 1) {
+    detail::byteswap_elements(src, dst, sizeof(T), count);
+  } else if (src != dst && 0u != count) {
+    std::memcpy(dst, src, count);
+  }
+}
+
+/// Reverse the bytes of each element of a contiguous container, in place.
+/**
+ * \param[inout] range a contiguous range such as a std::vector, std::array or std::span
+ * \sa byteswap_n(T *, std::size_t)
+ */
+template<
+  typename RangeT,
+  typename = decltype(std::data(std::declval<RangeT &>()), std::size(std::declval<RangeT &>()))>
+void
+byteswap_n(RangeT && range) noexcept
+{
+  byteswap_n(std::data(range), std::size(range));
+}
+
+/// Convert an array from one byte order to another.
+/**
+ * The elements are byte swapped if the byte orders differ, and copied otherwise.
+ *
+ * \code
+ * // Decode a big endian buffer received from a sensor.
+ * rcpputils::convert_endian(received, decoded, count, rcpputils::endian::big);
+ * \endcode
+ *
+ * \param[in] src the elements to convert
+ * \param[out] dst the array to write to, which may be `src` but must not otherwise overlap it
+ * \param[in] count the number of elements
+ * \param[in] from the byte order of `src`
+ * \param[in] to the byte order to write `dst` in
+ * \sa byteswap_n(const T *, T *, std::size_t)
+ */
+template<typename T>
+void
+convert_endian(
+  const T * src, T * dst, std::size_t count, endian from, endian to = endian::native) noexcept
+{
+  detail::check_byteswap_type<T>();
+  if (sizeof(T) > 1 && from != to) {
+    byteswap_n(src, dst, count);
+  } else if (src != dst && 0u != count) {
+    std::memcpy(dst, src, count * sizeof(T));
+  }
+}
+}  // namespace rcpputils
+
 #endif  // RCPPUTILS__ENDIAN_HPP_
@@ -19,12 +19,209 @@
 #ifndef RCPPUTILS__FIND_AND_REPLACE_HPP_
 #define RCPPUTILS__FIND_AND_REPLACE_HPP_
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/visibility_control.hpp"
 
 namespace rcpputils
 {
 
+namespace detail
+{
+template<typename T>
+struct type_identity
+{
+  using type = T;
+};
+
+// Used to deduce the character type from the input only, so that find and replace strings may
+// be given as anything convertible to a string view of that type.
+template<typename T>
+using type_identity_t = typename type_identity<T>::type;
+
+template<typename CharT, std::size_t Length>
+std::basic_string<CharT>
+normalize_to_basic_string(const CharT (& char_string)[Length])
+{
+  return std::basic_string<CharT>(char_string);
+}
+
+template<typename StringLikeT>
+StringLikeT &&
+normalize_to_basic_string(StringLikeT && string_like)
+{
+  return std::forward<StringLikeT>(string_like);
+}
+}  // namespace detail
+
+/// Find and replace all instances of a string with another string, writing to an iterator.
+/**
+ * The result is streamed to `out` without building an intermediate string.
+ *
+ * \param[in] input The input string.
+ * \param[in] find The substring to replace.
+ * \param[in] replace The string to substitute for each occurrence of `find`.
+ * \param[in] out The output iterator to write the result to.
+ * \return The output iterator one past the last character written.
+ */
+template<
+  class CharT,
+  class Traits,
+  class OutputIt
+>
+OutputIt
+find_and_replace(
+  std::basic_string_view<CharT, Traits> input,
+  detail::type_identity_t<std::basic_string_view<CharT, Traits>> find,
+  detail::type_identity_t<std::basic_string_view<CharT, Traits>> replace,
+  OutputIt out)
+{
+  if (find.empty()) {
+    return std::copy(input.begin(), input.end(), out);
+  }
+  std::size_t begin = 0;
+  for (std::size_t pos = input.find(find); pos != input.npos;
+    pos = input.find(find, pos + find.length()))
+  {
+    out = std::copy(input.begin() + begin, input.begin() + pos, out);
+    out = std::copy(replace.begin(), replace.end(), out);
+    begin = pos + find.length();
+  }
+  return std::copy(input.begin() + begin, input.end(), out);
+}
+
+/// Find and replace all instances of a string with another string, appending to a buffer.
+/**
+ * The output grows at most once, by exactly the length of the result.
+ *
+ * \param[in] input The input string, which must not alias `output`.
+ * \param[in] find The substring to replace.
+ * \param[in] replace The string to substitute for each occurrence of `find`.
+ * \param[inout] output The string the result is appended to.
+ */
+template<
+  class CharT,
+  class Traits,
+  class Allocator
+>
+void
+find_and_replace(
+  std::basic_string_view<CharT, Traits> input,
+  detail::type_identity_t<std::basic_string_view<CharT, Traits>> find,
+  detail::type_identity_t<std::basic_string_view<CharT, Traits>> replace,
+  std::basic_string<CharT, Traits, Allocator> & output)
+{
+  const std::size_t find_len = find.length();
+  if (0u == find_len) {
+    output.append(input);
+    return;
+  }
+  // Count the matches first so the output is allocated once, then build it front to back.
+  std::size_t count = 0;
+  for (std::size_t pos = input.find(find); pos != input.npos;
+    pos = input.find(find, pos + find_len))
+  {
+    ++count;
+  }
+  output.reserve(output.length() + input.length() - count * find_len + count * replace.length());
+  std::size_t begin = 0;
+  for (std::size_t pos = input.find(find); pos != input.npos;
+    pos = input.find(find, pos + find_len))
+  {
+    output.append(input.substr(begin, pos - begin));
+    output.append(replace);
+    begin = pos + find_len;
+  }
+  output.append(input.substr(begin));
+}
+
+/// Find and replace all instances of a string with another string, modifying the input.
+/**
+ * Replacements no longer than `find` are made in a single forward pass without allocating.
+ * Longer replacements resize the string once, move its contents to the end of the new buffer
+ * and rebuild it front to back, so it only reallocates if its capacity is exceeded.
+ *
+ * \param[inout] input The string to modify.
+ * \param[in] find The substring to replace, which must not refer into `input`.
+ * \param[in] replace The string to substitute for each occurrence of `find`, which must not
+ *   refer into `input`.
+ * \return The number of replacements made.
+ */
+template<
+  class CharT,
+  class Traits,
+  class Allocator
+>
+std::size_t
+find_and_replace_in_place(
+  std::basic_string<CharT, Traits, Allocator> & input,
+  detail::type_identity_t<std::basic_string_view<CharT, Traits>> find,
+  detail::type_identity_t<std::basic_string_view<CharT, Traits>> replace)
+{
+  using view_type = std::basic_string_view<CharT, Traits>;
+  const std::size_t find_len = find.length();
+  const std::size_t replace_len = replace.length();
+  if (0u == find_len) {
+    return 0u;
+  }
+  std::size_t count = 0;
+  if (find_len == replace_len) {
+    for (std::size_t pos = input.find(find.data(), 0, find_len); pos != input.npos;
+      pos = input.find(find.data(), pos + find_len, find_len))
+    {
+      Traits::copy(&input[pos], replace.data(), replace_len);
+      ++count;
+    }
+    return count;
+  }
+  // Source text is read from [read, length) of `source_end` and written at `write` <= read.
+  std::size_t read = 0;
+  std::size_t source_end = input.length();
+  if (replace_len > find_len) {
+    for (std::size_t pos = input.find(find.data(), 0, find_len); pos != input.npos;
+      pos = input.find(find.data(), pos + find_len, find_len))
+    {
+      ++count;
+    }
+    if (0u == count) {
+      return 0u;
+    }
+    // Shift the original text to the end of the grown string; the output then never catches up
+    // with the unread text, because each replacement consumes part of the gap.
+    read = count * (replace_len - find_len);
+    input.resize(source_end + read);
+    Traits::move(&input[read], input.data(), source_end);
+    source_end = input.length();
+    count = 0;
+  }
+  CharT * const data = &input[0];
+  std::size_t write = 0;
+  for (;;) {
+    const std::size_t pos = view_type(data, source_end).find(find, read);
+    const std::size_t end = pos == view_type::npos ? source_end : pos;
+    Traits::move(data + write, data + read, end - read);
+    write += end - read;
+    if (pos == view_type::npos) {
+      break;
+    }
+    Traits::copy(data + write, replace.data(), replace_len);
+    write += replace_len;
+    read = pos + find_len;
+    ++count;
+  }
+  input.resize(write);
+  return count;
+}
+
 /// Find and replace all instances of a string with another string.
 /**
  * \param[in] input The input string.
@@ -44,40 +241,30 @@ find_and_replace(
   const std::basic_string<CharT, Traits, Allocator> & find,
   const std::basic_string<CharT, Traits, Allocator> & replace)
 {
-  std::basic_string<CharT, Traits, Allocator> output = input;
+  using string_type = std::basic_string<CharT, Traits, Allocator>;
+  using view_type = std::basic_string_view<CharT, Traits>;
   const std::size_t find_len = find.length();
   const std::size_t replace_len = replace.length();
-  if (find == replace) {
-    return output;
+  if (find == replace || 0u == find_len || input.find(find) == string_type::npos) {
+    return input;
   }
-  if (0u == find_len) {
+  if (1u == find_len && 1u == replace_len) {
+    string_type output = input;
+    std::replace(output.begin(), output.end(), find[0], replace[0]);
     return output;
   }
-  std::size_t pos = output.find(find);
-  while (pos != std::basic_string<CharT, Traits, Allocator>::npos) {
-    output.replace(pos, find_len, replace);
-    pos = output.find(find, pos + replace_len);
+  if (find_len == replace_len) {
+    // Same length replacements never move the rest of the string, so patch a copy in place.
+    string_type output = input;
+    find_and_replace_in_place(output, find, replace);
+    return output;
   }
+  // Replacing in a copy instead would shift the tail of the string for every match.
+  string_type output(input.get_allocator());
+  find_and_replace(view_type(input), find, replace, output);
   return output;
 }
 
-namespace detail
-{
-template<typename CharT, std::size_t Length>
-std::basic_string<CharT>
-normalize_to_basic_string(const CharT (& char_string)[Length])
-{
-  return std::basic_string<CharT>(char_string);
-}
-
-template<typename StringLikeT>
-StringLikeT &&
-normalize_to_basic_string(StringLikeT && string_like)
-{
-  return string_like;
-}
-}  // namespace detail
-
 /// Find and replace all instances of a string with another string.
 /**
  * \param[in] input The input string.
@@ -93,13 +280,68 @@ find_and_replace(
   FindT && find,
   ReplaceT && replace)
 {
-  auto input_str = detail::normalize_to_basic_string(input);
-  return find_and_replace<typename decltype(input_str)::value_type>(
+  // Bind by reference, so that string inputs are not copied before being copied again.
+  auto && input_str = detail::normalize_to_basic_string(std::forward<InputT>(input));
+  return find_and_replace<typename std::decay_t<decltype(input_str)>::value_type>(
     input_str,
-    detail::normalize_to_basic_string(find),
-    detail::normalize_to_basic_string(replace));
+    detail::normalize_to_basic_string(std::forward<FindT>(find)),
+    detail::normalize_to_basic_string(std::forward<ReplaceT>(replace)));
 }
 
+/// Replace many different substrings in a single pass.
+/**
+ * An Aho-Corasick automaton is built once from a set of find/replace pairs, after which every
+ * occurrence of any `find` string is substituted in one linear scan of the input, instead of
+ * one scan and copy per pair as with chained find_and_replace() calls.
+ *
+ * Matches are selected leftmost-longest: among matches starting at the earliest position the
+ * longest one wins, and scanning then resumes right after it.
+ * Replacement text is never rescanned.
+ *
+ * The replacer is immutable once constructed, so a single instance may be used concurrently
+ * from multiple threads.
+ */
+class multi_replacer
+{
+public:
+  /// Compile a set of replacements.
+  /**
+   * \param[in] replacements the pairs of substring to find and string to substitute for it
+   * \throws std::invalid_argument if a `find` string is empty or appears more than once
+   */
+  RCPPUTILS_PUBLIC
+  explicit multi_replacer(const std::vector<std::pair<std::string, std::string>> & replacements);
+
+  /// Replace all matches in the input.
+  /**
+   * \param[in] input the input string
+   * \return A copy of the input with every match replaced.
+   */
+  RCPPUTILS_PUBLIC
+  std::string
+  apply(std::string_view input) const;
+
+  /// Replace all matches in the input, appending the result to `output`.
+  /**
+   * \param[in] input the input string, which must not alias `output`
+   * \param[inout] output the string to append to; its capacity is reused
+   */
+  RCPPUTILS_PUBLIC
+  void
+  apply(std::string_view input, std::string & output) const;
+
+private:
+  std::array<std::uint16_t, 256> char_class_{};
+  std::size_t class_count_{1};
+  // Complete DFA transitions, indexed by state * class_count_ + character class.
+  std::vector<std::uint32_t> transitions_;
+  // Length of the longest prefix of a pattern each state corresponds to.
+  std::vector<std::uint32_t> depth_;
+  // Index of the longest pattern ending at each state, or UINT32_MAX if there is none.
+  std::vector<std::uint32_t> match_;
+  std::vector<std::pair<std::string, std::string>> replacements_;
+};
+
 }  // namespace rcpputils
 
 #endif  // RCPPUTILS__FIND_AND_REPLACE_HPP_
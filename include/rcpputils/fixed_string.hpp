@@ -0,0 +1,262 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file fixed_string.hpp
+ * \brief Fixed capacity string which never allocates, for use in realtime code.
+ */
+
+#ifndef RCPPUTILS__FIXED_STRING_HPP_
+#define RCPPUTILS__FIXED_STRING_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "rcpputils/join.hpp"
+
+namespace rcpputils
+{
+
+/// A null terminated string stored inline, holding at most `Capacity` characters.
+/**
+ * Appending never allocates or throws: text which does not fit is truncated and the string is
+ * marked as truncated(), after which further appends are ignored until clear() is called.
+ * This keeps a truncated string a prefix of the intended text.
+ *
+ * \tparam Capacity the maximum number of characters, excluding the null terminator.
+ */
+template<std::size_t Capacity>
+class fixed_string
+{
+public:
+  using value_type = char;
+  using traits_type = std::char_traits<char>;
+  using size_type = std::size_t;
+
+  /// Construct an empty string.
+  constexpr fixed_string() noexcept = default;
+
+  /// Construct a string holding as much of `text` as fits.
+  constexpr explicit fixed_string(std::string_view text) noexcept
+  {
+    append(text);
+  }
+
+  /// Get the maximum number of characters the string can hold.
+  static constexpr size_type
+  capacity() noexcept
+  {
+    return Capacity;
+  }
+
+  constexpr size_type
+  size() const noexcept
+  {
+    return size_;
+  }
+
+  constexpr bool
+  empty() const noexcept
+  {
+    return 0u == size_;
+  }
+
+  /// Get the number of characters which can still be appended.
+  constexpr size_type
+  available() const noexcept
+  {
+    return Capacity - size_;
+  }
+
+  /// Whether any appended text was dropped since construction or the last clear().
+  constexpr bool
+  truncated() const noexcept
+  {
+    return truncated_;
+  }
+
+  constexpr const char *
+  data() const noexcept
+  {
+    return data_;
+  }
+
+  constexpr const char *
+  c_str() const noexcept
+  {
+    return data_;
+  }
+
+  constexpr std::string_view
+  view() const noexcept
+  {
+    return std::string_view(data_, size_);
+  }
+
+  constexpr
+  operator std::string_view() const noexcept
+  {
+    return view();
+  }
+
+  /// Empty the string and reset the truncation flag.
+  constexpr void
+  clear() noexcept
+  {
+    size_ = 0;
+    data_[0] = '\0';
+    truncated_ = false;
+  }
+
+  /// Append as much of `text` as fits.
+  /**
+   * \return true if all of `text` was appended.
+   */
+  constexpr bool
+  append(std::string_view text) noexcept
+  {
+    if (truncated_) {
+      return text.empty();
+    }
+    size_type count = text.size();
+    if (count > available()) {
+      count = available();
+      truncated_ = true;
+    }
+    for (size_type i = 0; i < count; ++i) {
+      data_[size_ + i] = text[i];
+    }
+    size_ += count;
+    data_[size_] = '\0';
+    return !truncated_;
+  }
+
+  /// Append a character if it fits.
+  /**
+   * \return true if the character was appended.
+   */
+  constexpr bool
+  push_back(char c) noexcept
+  {
+    return append(std::string_view(&c, 1));
+  }
+
+  /// Append an integral or floating point number, formatted as std::ostream would by default.
+  /**
+   * \return true if the whole number was appended.
+   */
+  template<typename T>
+  bool
+  append_number(T value) noexcept
+  {
+    char buffer[detail::max_number_length];
+    return append(std::string_view(buffer, detail::format_number(buffer, value)));
+  }
+
+  constexpr fixed_string &
+  operator+=(std::string_view text) noexcept
+  {
+    append(text);
+    return *this;
+  }
+
+  constexpr fixed_string &
+  operator+=(char c) noexcept
+  {
+    push_back(c);
+    return *this;
+  }
+
+private:
+  char data_[Capacity + 1] = {};
+  size_type size_ = 0;
+  bool truncated_ = false;
+};
+
+namespace detail
+{
+template<std::size_t Capacity>
+struct join_fixed_string_sink
+{
+  using char_type = char;
+  // Streaming would allocate, so values must be strings or numbers, or be given a formatter.
+  static constexpr bool allows_stream = false;
+
+  void
+  write(std::string_view text) noexcept
+  {
+    out.append(text);
+  }
+
+  template<typename FormatterT, typename ValueT>
+  void
+  format(FormatterT & formatter, ValueT && value)
+  {
+    formatter(out, std::forward<ValueT>(value));
+  }
+
+  fixed_string<Capacity> & out;
+};
+}  // namespace detail
+
+/// Join values in a range by a given delimiter, appending to a fixed capacity string.
+/**
+ * This behaves like join_append() for std::basic_string, but never allocates as long as the
+ * values are strings or numbers, or a formatter appending to the fixed_string is given.
+ * Values of other types are rejected at compile time.
+ * If the result does not fit, it is truncated and `out.truncated()` is set.
+ *
+ * \param[inout] out the string to append to.
+ * \param[in] range any range of values, such as a container, an array or a span.
+ * \param[in] delim is a delimiter to join values turned into strings; may be null.
+ * \param[in] formatter is an optional callable formatting each value.
+ * \return true if the whole result was appended.
+ */
+template<
+  std::size_t Capacity, typename RangeT, typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<detail::is_range_v<RangeT>>>
+bool
+join_append(
+  fixed_string<Capacity> & out, const RangeT & range, const char * delim,
+  FormatterT formatter = {})
+{
+  detail::join_fixed_string_sink<Capacity> sink{out};
+  detail::join_into_sink(
+    sink, std::begin(range), std::end(range), detail::join_delimiter(delim), formatter);
+  return !out.truncated();
+}
+
+/// Join values in an iterator range by a given delimiter, appending to a fixed capacity string.
+/**
+ * \sa join_append(fixed_string<Capacity> &, const RangeT &, const char *, FormatterT)
+ */
+template<
+  std::size_t Capacity, typename InputIt, typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<!detail::is_range_v<InputIt>>>
+bool
+join_append(
+  fixed_string<Capacity> & out, InputIt first, InputIt last, const char * delim,
+  FormatterT formatter = {})
+{
+  detail::join_fixed_string_sink<Capacity> sink{out};
+  detail::join_into_sink(sink, first, last, detail::join_delimiter(delim), formatter);
+  return !out.truncated();
+}
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__FIXED_STRING_HPP_
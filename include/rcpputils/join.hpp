@@ -13,43 +13,368 @@
 // limitations under the License.
 
 /*! \file join.hpp
- * \brief Join container of objects into single string
+ * \brief Join ranges of objects into single string
  */
 
 #ifndef RCPPUTILS__JOIN_HPP_
 #define RCPPUTILS__JOIN_HPP_
 
 #include <algorithm>
-#include <cstring>
+#include <charconv>
+#include <cstddef>
 #include <iterator>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace rcpputils
 {
 
-/// Join values in a container turned into strings by a given delimiter
+namespace detail
+{
+template<typename T>
+struct is_character : std::false_type {};
+
+template<>
+struct is_character<char>: std::true_type {};
+
+template<>
+struct is_character<signed char>: std::true_type {};
+
+template<>
+struct is_character<unsigned char>: std::true_type {};
+
+template<>
+struct is_character<wchar_t>: std::true_type {};
+
+template<>
+struct is_character<char16_t>: std::true_type {};
+
+template<>
+struct is_character<char32_t>: std::true_type {};
+
+// Whether std::to_chars produces the same text for T as streaming it to an std::ostream.
+// Characters are streamed as themselves rather than as numbers, so they are excluded.
+template<typename T>
+constexpr bool has_to_chars_v =
+  (std::is_integral_v<T> && !is_character<T>::value) ||
+#if defined(__cpp_lib_to_chars) || defined(_MSC_VER)
+  std::is_floating_point_v<T>;
+#else
+  false;
+#endif
+
+// Large enough for any integer, and for floating point numbers at the default stream precision.
+constexpr std::size_t max_number_length = 64;
+
+// Format a number as an std::ostream with default settings would, returning its length.
+template<typename T>
+std::size_t
+format_number(char (& buffer)[max_number_length], T value) noexcept
+{
+  static_assert(has_to_chars_v<T>, "format_number requires an integral or floating point type");
+  std::to_chars_result converted;
+  if constexpr (std::is_same_v<T, bool>) {
+    converted = std::to_chars(buffer, buffer + max_number_length, static_cast<int>(value));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    // Matches the "%g" format std::ostream uses by default.
+    converted = std::to_chars(
+      buffer, buffer + max_number_length, value, std::chars_format::general, 6);
+  } else {
+    converted = std::to_chars(buffer, buffer + max_number_length, value);
+  }
+  return static_cast<std::size_t>(converted.ptr - buffer);
+}
+
+template<typename T, typename = void>
+struct is_range : std::false_type {};
+
+template<typename T>
+struct is_range<T, std::void_t<
+    decltype(std::begin(std::declval<const T &>())),
+    decltype(std::end(std::declval<const T &>()))>>: std::true_type {};
+
+template<typename T>
+constexpr bool is_range_v = is_range<T>::value;
+
+/// Formats each value as is; selects the default formatting of join().
+struct join_identity
+{
+};
+
+// Appends to a string.
+template<typename StringT>
+struct join_string_sink
+{
+  using char_type = typename StringT::value_type;
+  static constexpr bool allows_stream = true;
+
+  void
+  write(std::basic_string_view<char_type, typename StringT::traits_type> text)
+  {
+    out.append(text);
+  }
+
+  template<typename FormatterT, typename ValueT>
+  void
+  format(FormatterT & formatter, ValueT && value)
+  {
+    formatter(out, std::forward<ValueT>(value));
+  }
+
+  StringT & out;
+};
+
+// Writes through an output iterator.
+template<typename CharT, typename OutputIt>
+struct join_iterator_sink
+{
+  using char_type = CharT;
+  static constexpr bool allows_stream = true;
+
+  void
+  write(std::basic_string_view<CharT> text)
+  {
+    out = std::copy(text.begin(), text.end(), out);
+  }
+
+  template<typename FormatterT, typename ValueT>
+  void
+  format(FormatterT & formatter, ValueT && value)
+  {
+    out = formatter(out, std::forward<ValueT>(value));
+  }
+
+  OutputIt out;
+};
+
+template<typename SinkT, typename ValueT>
+void
+join_write_value(
+  SinkT & sink, const ValueT & value,
+  std::optional<std::basic_ostringstream<typename SinkT::char_type>> & stream)
+{
+  using char_type = typename SinkT::char_type;
+  if constexpr (std::is_convertible_v<const ValueT &, std::basic_string_view<char_type>>) {
+    sink.write(std::basic_string_view<char_type>(value));
+  } else if constexpr (has_to_chars_v<ValueT>) {
+    char buffer[max_number_length];
+    const std::size_t length = format_number(buffer, value);
+    if constexpr (std::is_same_v<char_type, char>) {
+      sink.write(std::string_view(buffer, length));
+    } else {
+      char_type widened[max_number_length];
+      std::copy(buffer, buffer + length, widened);
+      sink.write(std::basic_string_view<char_type>(widened, length));
+    }
+  } else {
+    static_assert(
+      SinkT::allows_stream,
+      "values must be strings or numbers, or be given a formatter, to join without allocating");
+    // Only types without a faster path pay for a stream, which is reused for all of them.
+    if (stream) {
+      stream->str({});
+    } else {
+      stream.emplace();
+    }
+    *stream << value;
+    sink.write(stream->str());
+  }
+}
+
+template<typename SinkT, typename InputIt, typename FormatterT>
+void
+join_into_sink(
+  SinkT & sink, InputIt first, InputIt last,
+  std::basic_string_view<typename SinkT::char_type> delim, FormatterT & formatter)
+{
+  using value_type = decltype(*first);
+  std::optional<std::basic_ostringstream<typename SinkT::char_type>> stream;
+  for (bool first_value = true; first != last; ++first, first_value = false) {
+    if (!first_value) {
+      sink.write(delim);
+    }
+    if constexpr (std::is_same_v<FormatterT, join_identity>) {
+      join_write_value(sink, *first, stream);
+    } else if constexpr (std::is_invocable_v<FormatterT &, decltype((sink.out)), value_type>) {
+      sink.format(formatter, *first);
+    } else {
+      join_write_value(sink, formatter(*first), stream);
+    }
+  }
+}
+
+template<typename StringT, typename InputIt, typename FormatterT>
+void
+join_append(
+  StringT & out, InputIt first, InputIt last,
+  std::basic_string_view<typename StringT::value_type> delim, FormatterT & formatter)
+{
+  using char_type = typename StringT::value_type;
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_same_v<FormatterT, join_identity> &&
+    std::is_base_of_v<std::forward_iterator_tag, category> &&
+    std::is_convertible_v<decltype(*first), std::basic_string_view<char_type>>)
+  {
+    // The result length is known up front, so grow the output at most once.
+    std::size_t length = 0;
+    std::size_t count = 0;
+    for (InputIt it = first; it != last; ++it) {
+      length += std::basic_string_view<char_type>(*it).length();
+      ++count;
+    }
+    if (count > 0u) {
+      out.reserve(out.length() + length + (count - 1u) * delim.length());
+    }
+  }
+  join_string_sink<StringT> sink{out};
+  join_into_sink(sink, first, last, delim, formatter);
+}
+
+template<typename CharT>
+std::basic_string_view<CharT>
+join_delimiter(const CharT * delim)
+{
+  return delim ? std::basic_string_view<CharT>(delim) : std::basic_string_view<CharT>();
+}
+}  // namespace detail
+
+/// Join values in a range turned into strings by a given delimiter, appending to a string.
 /**
- * \param[in] container is a collection of values to be turned into string and joined.
+ * Delimiters are only written between values.
+ * By default, strings and string views are appended to an output grown at most once, and
+ * integral and floating point values are formatted with std::to_chars, producing the same text
+ * as an std::ostream with default settings would.
+ * Other value types are formatted with their stream insertion operator.
+ *
+ * A formatter may be provided to customize how each value is written, and may either
+ *  - take a value and return something to be formatted as above in its place, or
+ *  - take the output string and a value, and append to the string itself.
+ *
+ * \code
+ * std::string out = "parameters: ";
+ * rcpputils::join_append(out, parameter_map, ", ", [](std::string & s, const auto & kv) {
+ *     s.append(kv.first).append("=").append(kv.second);
+ *   });
+ * \endcode
+ *
+ * \param[inout] out the string to append to.
+ * \param[in] range any range of values, such as a container, an array or a span.
+ * \param[in] delim is a delimiter to join values turned into strings; may be null.
+ * \param[in] formatter is an optional callable formatting each value.
+ */
+template<
+  typename CharT, typename Traits, typename Allocator, typename RangeT,
+  typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<detail::is_range_v<RangeT>>>
+void
+join_append(
+  std::basic_string<CharT, Traits, Allocator> & out, const RangeT & range, const CharT * delim,
+  FormatterT formatter = {})
+{
+  detail::join_append(
+    out, std::begin(range), std::end(range), detail::join_delimiter(delim), formatter);
+}
+
+/// Join values in an iterator range turned into strings by a given delimiter, appending to a
+/// string.
+/**
+ * \sa join_append()
+ */
+template<
+  typename CharT, typename Traits, typename Allocator, typename InputIt,
+  typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<!detail::is_range_v<InputIt>>>
+void
+join_append(
+  std::basic_string<CharT, Traits, Allocator> & out, InputIt first, InputIt last,
+  const CharT * delim, FormatterT formatter = {})
+{
+  detail::join_append(out, first, last, detail::join_delimiter(delim), formatter);
+}
+
+/// Join values in a range turned into strings by a given delimiter, writing to an iterator.
+/**
+ * Values are formatted as by join_append(), except that a formatter taking the output takes
+ * the output iterator and returns the iterator past the last character it wrote.
+ *
+ * \param[in] out the output iterator to write to.
+ * \param[in] range any range of values, such as a container, an array or a span.
+ * \param[in] delim is a delimiter to join values turned into strings; may be null.
+ * \param[in] formatter is an optional callable formatting each value.
+ * \return The output iterator past the last character written.
+ */
+template<
+  typename OutputIt, typename RangeT, typename CharT,
+  typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<detail::is_range_v<RangeT>>>
+OutputIt
+join_to(OutputIt out, const RangeT & range, const CharT * delim, FormatterT formatter = {})
+{
+  detail::join_iterator_sink<CharT, OutputIt> sink{out};
+  detail::join_into_sink(
+    sink, std::begin(range), std::end(range), detail::join_delimiter(delim), formatter);
+  return sink.out;
+}
+
+/// Join values in an iterator range turned into strings by a given delimiter, writing to an
+/// iterator.
+/**
+ * \sa join_to()
+ */
+template<
+  typename OutputIt, typename InputIt, typename CharT,
+  typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<!detail::is_range_v<InputIt>>>
+OutputIt
+join_to(OutputIt out, InputIt first, InputIt last, const CharT * delim, FormatterT formatter = {})
+{
+  detail::join_iterator_sink<CharT, OutputIt> sink{out};
+  detail::join_into_sink(sink, first, last, detail::join_delimiter(delim), formatter);
+  return sink.out;
+}
+
+/// Join values in a range turned into strings by a given delimiter
+/**
+ * \param[in] range is any range of values to be turned into string and joined, such as a
+ *   container, an array or a span.
  * \param[in] delim is a delimiter to join values turned into strings.
+ * \param[in] formatter is an optional callable formatting each value, as for join_append().
  * \tparam CharT is the string character type.
- * \tparam ValueT is the container value type.
- * \tparam AllocatorT is the container allocator type.
- * \tparam ContainerT is the container template type.
+ * \tparam RangeT is the range type.
  * \return joined string
+ * \sa join_append()
  */
 template<
-  typename CharT, typename ValueT, typename AllocatorT,
-  template<typename T, class A> class ContainerT>
+  typename RangeT, typename CharT, typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<detail::is_range_v<RangeT>>>
 std::basic_string<CharT>
-join(const ContainerT<ValueT, AllocatorT> & container, const CharT * delim)
+join(const RangeT & range, const CharT * delim, FormatterT formatter = {})
 {
-  std::basic_ostringstream<CharT> s;
-  std::copy(container.begin(), container.end(), std::ostream_iterator<ValueT, CharT>(s, delim));
-  std::basic_string<CharT> result = s.str();
-  if (delim) {
-    result = result.substr(0, result.length() - strlen(delim));
-  }
+  std::basic_string<CharT> result;
+  join_append(result, range, delim, std::move(formatter));
+  return result;
+}
+
+/// Join values in an iterator range turned into strings by a given delimiter
+/**
+ * \param[in] first the beginning of the values to be turned into string and joined.
+ * \param[in] last the end of the values to be turned into string and joined.
+ * \param[in] delim is a delimiter to join values turned into strings.
+ * \param[in] formatter is an optional callable formatting each value, as for join_append().
+ * \return joined string
+ */
+template<
+  typename InputIt, typename CharT, typename FormatterT = detail::join_identity,
+  typename = std::enable_if_t<!detail::is_range_v<InputIt>>>
+std::basic_string<CharT>
+join(InputIt first, InputIt last, const CharT * delim, FormatterT formatter = {})
+{
+  std::basic_string<CharT> result;
+  join_append(result, first, last, delim, std::move(formatter));
   return result;
 }
 
@@ -0,0 +1,293 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file joined_view.hpp
+ * \brief Lazily joined strings, written with scatter-gather I/O instead of being concatenated.
+ */
+
+#ifndef RCPPUTILS__JOINED_VIEW_HPP_
+#define RCPPUTILS__JOINED_VIEW_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
+#include "rcpputils/visibility_control.hpp"
+
+namespace rcpputils
+{
+
+/// The strings of a range joined by a delimiter, without concatenating them.
+/**
+ * Iterating over the view yields its pieces, i.e. the elements and the delimiters between them,
+ * as `std::string_view`s pointing into the range and the delimiter, so that they may be written
+ * with `writev` or copied elsewhere without building the joined string first.
+ * Empty pieces are skipped.
+ *
+ * The view refers to the range and the delimiter, which must outlive it.
+ *
+ * \tparam RangeT a range of values convertible to `std::string_view`.
+ */
+template<typename RangeT>
+class joined_view
+{
+  using range_iterator = decltype(std::begin(std::declval<const RangeT &>()));
+
+  static_assert(
+    std::is_convertible_v<decltype(*std::declval<range_iterator>()), std::string_view>,
+    "joined_view requires a range of values convertible to std::string_view");
+
+public:
+  /// Forward iterator over the pieces of a joined_view.
+  class iterator
+  {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view *;
+    using reference = std::string_view;
+
+    iterator() = default;
+
+    reference
+    operator*() const
+    {
+      return at_delimiter_ ? view_->delimiter_ : std::string_view(*it_);
+    }
+
+    iterator &
+    operator++()
+    {
+      advance();
+      skip_empty();
+      return *this;
+    }
+
+    iterator
+    operator++(int)
+    {
+      iterator previous = *this;
+      ++(*this);
+      return previous;
+    }
+
+    bool
+    operator==(const iterator & other) const
+    {
+      return it_ == other.it_ && at_delimiter_ == other.at_delimiter_;
+    }
+
+    bool
+    operator!=(const iterator & other) const
+    {
+      return !(*this == other);
+    }
+
+private:
+    friend class joined_view;
+
+    iterator(const joined_view * view, range_iterator it)
+    : view_(view), it_(it)
+    {
+      skip_empty();
+    }
+
+    void
+    advance()
+    {
+      if (at_delimiter_) {
+        at_delimiter_ = false;
+      } else {
+        ++it_;
+        at_delimiter_ = it_ != view_->end_;
+      }
+    }
+
+    void
+    skip_empty()
+    {
+      while (it_ != view_->end_ && (**this).empty()) {
+        advance();
+      }
+    }
+
+    const joined_view * view_{nullptr};
+    range_iterator it_{};
+    // Whether the current piece is the delimiter preceding *it_.
+    bool at_delimiter_{false};
+  };
+
+  /// Create a view of the elements of `range` joined by `delimiter`.
+  joined_view(const RangeT & range, std::string_view delimiter)
+  : begin_(std::begin(range)), end_(std::end(range)), delimiter_(delimiter)
+  {
+  }
+
+  iterator
+  begin() const
+  {
+    return iterator(this, begin_);
+  }
+
+  iterator
+  end() const
+  {
+    return iterator(this, end_);
+  }
+
+  /// Get the length of the joined string.
+  std::size_t
+  size() const
+  {
+    std::size_t length = 0;
+    std::size_t count = 0;
+    for (range_iterator it = begin_; it != end_; ++it, ++count) {
+      length += std::string_view(*it).size();
+    }
+    return 0u == count ? 0u : length + (count - 1u) * delimiter_.size();
+  }
+
+  /// Build the joined string.
+  std::string
+  str() const
+  {
+    std::string result;
+    result.reserve(size());
+    for (const std::string_view piece : *this) {
+      result.append(piece);
+    }
+    return result;
+  }
+
+#ifndef _WIN32
+  /// Describe pieces of the view as iovecs, starting at `position`.
+  /**
+   * \param[inout] position the first piece to describe, advanced past the last piece described
+   * \param[out] iov the iovecs to fill
+   * \param[in] count the number of iovecs available
+   * \return The number of iovecs filled.
+   */
+  std::size_t
+  fill_iovec(iterator & position, iovec * iov, std::size_t count) const
+  {
+    const iterator last = end();
+    std::size_t filled = 0;
+    for (; filled < count && position != last; ++position, ++filled) {
+      const std::string_view piece = *position;
+      iov[filled].iov_base = const_cast<char *>(piece.data());
+      iov[filled].iov_len = piece.size();
+    }
+    return filled;
+  }
+#endif
+
+private:
+  range_iterator begin_;
+  range_iterator end_;
+  std::string_view delimiter_;
+};
+
+#ifndef _WIN32
+namespace detail
+{
+// Number of pieces of a joined_view passed to each writev call.
+constexpr std::size_t joined_view_iovec_batch = 256;
+}  // namespace detail
+
+/// Write all the bytes described by an array of iovecs, retrying after partial writes.
+/**
+ * Writes are retried when interrupted by a signal, and after waiting for the descriptor to
+ * become writable if it is non-blocking.
+ * The iovecs are modified to track progress, so their contents are unspecified afterwards.
+ *
+ * \param[in] fd the file descriptor to write to
+ * \param[inout] iov the buffers to write
+ * \param[in] count the number of buffers, which may exceed IOV_MAX
+ * \return The number of bytes written.
+ * \throws std::system_error if writing fails
+ */
+RCPPUTILS_PUBLIC
+std::size_t
+writev_all(int fd, iovec * iov, std::size_t count);
+
+/// Write all the pieces of a joined view, batching them into calls to `writev`.
+/**
+ * \param[in] fd the file descriptor to write to
+ * \param[in] view the joined view to write
+ * \return The number of bytes written.
+ * \throws std::system_error if writing fails
+ * \sa writev_all(int, iovec *, std::size_t)
+ */
+template<typename RangeT>
+std::size_t
+writev_all(int fd, const joined_view<RangeT> & view)
+{
+  iovec iov[detail::joined_view_iovec_batch];
+  std::size_t written = 0;
+  auto position = view.begin();
+  while (std::size_t count = view.fill_iovec(position, iov, detail::joined_view_iovec_batch)) {
+    written += writev_all(fd, iov, count);
+  }
+  return written;
+}
+
+/// Write all the bytes described by an array of iovecs at a file offset.
+/**
+ * Like writev_all(), but writes with `pwritev` starting at `offset`, without using or changing
+ * the file offset of the descriptor.
+ *
+ * \param[in] fd the file descriptor to write to, which must be seekable
+ * \param[inout] iov the buffers to write
+ * \param[in] count the number of buffers, which may exceed IOV_MAX
+ * \param[in] offset the file offset to write at
+ * \return The number of bytes written.
+ * \throws std::system_error if writing fails
+ */
+RCPPUTILS_PUBLIC
+std::size_t
+pwritev_all(int fd, iovec * iov, std::size_t count, off_t offset);
+
+/// Write all the pieces of a joined view at a file offset.
+/**
+ * \param[in] fd the file descriptor to write to, which must be seekable
+ * \param[in] view the joined view to write
+ * \param[in] offset the file offset to write at
+ * \return The number of bytes written.
+ * \throws std::system_error if writing fails
+ */
+template<typename RangeT>
+std::size_t
+pwritev_all(int fd, const joined_view<RangeT> & view, off_t offset)
+{
+  iovec iov[detail::joined_view_iovec_batch];
+  std::size_t written = 0;
+  auto position = view.begin();
+  while (std::size_t count = view.fill_iovec(position, iov, detail::joined_view_iovec_batch)) {
+    written += pwritev_all(fd, iov, count, offset + static_cast<off_t>(written));
+  }
+  return written;
+}
+#endif
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__JOINED_VIEW_HPP_
@@ -36,14 +36,471 @@
 #ifndef RCPPUTILS__SPLIT_HPP_
 #define RCPPUTILS__SPLIT_HPP_
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
-#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "rcpputils/visibility_control.hpp"
+
 namespace rcpputils
 {
 
+/// A set of single-character delimiters, e.g. all whitespace characters.
+/**
+ * Membership is stored as a 256-bit table so that scalar lookups are a single bit test.
+ * The distinct characters are also kept in insertion order (up to max_vectorized_size of them)
+ * so that delimiter scanning can compare whole blocks of input against each of them at once.
+ */
+class delimiter_set
+{
+public:
+  /// Maximum number of distinct delimiters for which vectorized scanning is used.
+  static constexpr std::size_t max_vectorized_size = 16;
+
+  /// Construct a delimiter set containing each character of `chars`.
+  /**
+   * \param[in] chars the delimiter characters; duplicates are ignored
+   */
+  constexpr explicit delimiter_set(std::string_view chars) noexcept
+  {
+    for (const char c : chars) {
+      if (contains(c)) {
+        continue;
+      }
+      const auto uc = static_cast<unsigned char>(c);
+      bits_[uc >> 6] |= std::uint64_t{1} << (uc & 63u);
+      if (size_ < max_vectorized_size) {
+        chars_[size_] = c;
+      }
+      ++size_;
+    }
+  }
+
+  /// Check whether `c` is one of the delimiters.
+  constexpr bool contains(char c) const noexcept
+  {
+    const auto uc = static_cast<unsigned char>(c);
+    return (bits_[uc >> 6] >> (uc & 63u)) & 1u;
+  }
+
+  /// Number of distinct delimiters in the set.
+  constexpr std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// The distinct delimiters, if there are at most max_vectorized_size of them.
+  /**
+   * \return the delimiters in insertion order, or an empty view if the set is too large.
+   */
+  constexpr std::string_view chars() const noexcept
+  {
+    return size_ <= max_vectorized_size ? std::string_view(chars_, size_) : std::string_view();
+  }
+
+private:
+  std::uint64_t bits_[4]{};
+  char chars_[max_vectorized_size]{};
+  std::size_t size_{0};
+};
+
+/// A multi-character delimiter, compiled once for repeated splitting.
+/**
+ * Wraps a std::boyer_moore_horspool_searcher over an owned copy of the delimiter, so that the
+ * skip table is built once and reused by every split performed with this object.
+ * Searching is const and does not modify the object, so a single instance may be shared by
+ * multiple threads.
+ */
+class compiled_delimiter
+{
+public:
+  /// Compile a delimiter.
+  /**
+   * \param[in] delim the delimiter string; an empty delimiter never matches
+   */
+  explicit compiled_delimiter(std::string_view delim)
+  : pattern_(delim),
+    searcher_(pattern_.begin(), pattern_.end())
+  {}
+
+  compiled_delimiter(const compiled_delimiter & other)
+  : compiled_delimiter(other.pattern_)
+  {}
+
+  compiled_delimiter &
+  operator=(const compiled_delimiter & other)
+  {
+    if (this != &other) {
+      pattern_ = other.pattern_;
+      searcher_ = searcher_type(pattern_.begin(), pattern_.end());
+    }
+    return *this;
+  }
+
+  /// Get the delimiter string.
+  const std::string &
+  str() const noexcept
+  {
+    return pattern_;
+  }
+
+  /// Get the length of the delimiter.
+  std::size_t
+  size() const noexcept
+  {
+    return pattern_.size();
+  }
+
+  /// Find the first occurrence of the delimiter in `input` at or after `pos`.
+  /**
+   * \return the position of the delimiter, or std::string_view::npos if there is none.
+   */
+  std::size_t
+  find(std::string_view input, std::size_t pos = 0) const
+  {
+    if (pattern_.empty() || pos >= input.size()) {
+      return std::string_view::npos;
+    }
+    const auto match = searcher_(input.begin() + pos, input.end());
+    return match.first == input.end() ?
+           std::string_view::npos :
+           static_cast<std::size_t>(match.first - input.begin());
+  }
+
+private:
+  using searcher_type = std::boyer_moore_horspool_searcher<std::string::const_iterator>;
+
+  std::string pattern_;
+  searcher_type searcher_;
+};
+
+namespace detail
+{
+/// Find the first character of `input` at or after `pos` which is in `delims`.
+/**
+ * Scans 16 or 32 bytes per step with SSE2, AVX2 or NEON, depending on what the running CPU
+ * supports, and falls back to a scalar table lookup otherwise.
+ *
+ * \return the position of the delimiter, or std::string_view::npos if there is none.
+ */
+RCPPUTILS_PUBLIC
+std::size_t
+find_first_of(std::string_view input, std::size_t pos, const delimiter_set & delims) noexcept;
+
+constexpr std::size_t
+find_delimiter(std::string_view input, char delim, std::size_t pos) noexcept
+{
+  return input.find(delim, pos);
+}
+
+inline std::size_t
+find_delimiter(std::string_view input, const delimiter_set & delims, std::size_t pos) noexcept
+{
+  return find_first_of(input, pos, delims);
+}
+
+constexpr std::size_t
+find_delimiter(std::string_view input, std::string_view delim, std::size_t pos) noexcept
+{
+  return delim.empty() ? std::string_view::npos : input.find(delim, pos);
+}
+
+inline std::size_t
+find_delimiter(std::string_view input, const compiled_delimiter & delim, std::size_t pos)
+{
+  return delim.find(input, pos);
+}
+
+constexpr std::size_t
+rfind_delimiter(std::string_view input, char delim) noexcept
+{
+  return input.rfind(delim);
+}
+
+constexpr std::size_t
+rfind_delimiter(std::string_view input, const delimiter_set & delims) noexcept
+{
+  for (std::size_t i = input.size(); i > 0; --i) {
+    if (delims.contains(input[i - 1])) {
+      return i - 1;
+    }
+  }
+  return std::string_view::npos;
+}
+
+constexpr std::size_t
+rfind_delimiter(std::string_view input, std::string_view delim) noexcept
+{
+  return delim.empty() ? std::string_view::npos : input.rfind(delim);
+}
+
+inline std::size_t
+rfind_delimiter(std::string_view input, const compiled_delimiter & delim) noexcept
+{
+  return rfind_delimiter(input, std::string_view(delim.str()));
+}
+
+constexpr std::size_t
+delimiter_size(char) noexcept
+{
+  return 1;
+}
+
+constexpr std::size_t
+delimiter_size(const delimiter_set &) noexcept
+{
+  return 1;
+}
+
+constexpr std::size_t
+delimiter_size(std::string_view delim) noexcept
+{
+  return delim.size();
+}
+
+inline std::size_t
+delimiter_size(const compiled_delimiter & delim) noexcept
+{
+  return delim.size();
+}
+}  // namespace detail
+
+/// Lazy, non-owning range over the tokens of a string split by a delimiter.
+/**
+ * Tokens are produced on demand as std::string_view instances pointing into the input, so
+ * iterating the range performs no heap allocation.
+ * The input must outlive the range and any token obtained from it.
+ *
+ * The tokenization rules match those of rcpputils::split():
+ *  - an empty input yields no tokens,
+ *  - a trailing delimiter does not produce a trailing empty token,
+ *  - empty tokens are dropped if `skip_empty` is true.
+ *
+ * \tparam DelimiterT the delimiter type: a single `char`, a rcpputils::delimiter_set, a
+ *   `std::string_view` separator, or a reference to a rcpputils::compiled_delimiter.
+ *   A compiled delimiter is held by reference and must outlive the range.
+ */
+template<typename DelimiterT = char>
+class split_view
+{
+public:
+  /// Forward iterator over the tokens of a split_view.
+  class iterator
+  {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view *;
+    using reference = const std::string_view &;
+
+    /// Construct a past-the-end iterator.
+    constexpr iterator() = default;
+
+    constexpr reference operator*() const noexcept
+    {
+      return token_;
+    }
+
+    constexpr pointer operator->() const noexcept
+    {
+      return &token_;
+    }
+
+    constexpr iterator & operator++() noexcept
+    {
+      advance();
+      return *this;
+    }
+
+    constexpr iterator operator++(int) noexcept
+    {
+      iterator tmp = *this;
+      advance();
+      return tmp;
+    }
+
+    friend constexpr bool operator==(const iterator & lhs, const iterator & rhs) noexcept
+    {
+      return lhs.view_ == rhs.view_ && lhs.start_ == rhs.start_;
+    }
+
+    friend constexpr bool operator!=(const iterator & lhs, const iterator & rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+private:
+    friend class split_view;
+
+    constexpr explicit iterator(const split_view * view) noexcept
+    : view_(view), start_(0), end_(0)
+    {
+      if (view_->input_.empty()) {
+        view_ = nullptr;
+        return;
+      }
+      find_token(0);
+    }
+
+    constexpr void advance() noexcept
+    {
+      const std::size_t next = end_ + detail::delimiter_size(view_->delim_);
+      if (end_ >= view_->input_.size() || next >= view_->input_.size()) {
+        // Either the last token ended the input, or only a trailing delimiter remains.
+        reset();
+        return;
+      }
+      find_token(next);
+    }
+
+    constexpr void find_token(std::size_t start) noexcept
+    {
+      const std::string_view input = view_->input_;
+      const std::size_t delim_size = detail::delimiter_size(view_->delim_);
+      for (;;) {
+        std::size_t end = detail::find_delimiter(input, view_->delim_, start);
+        if (end == std::string_view::npos) {
+          end = input.size();
+        }
+        if (!view_->skip_empty_ || end != start) {
+          start_ = start;
+          end_ = end;
+          token_ = input.substr(start, end - start);
+          return;
+        }
+        if (end + delim_size >= input.size()) {
+          reset();
+          return;
+        }
+        start = end + delim_size;
+      }
+    }
+
+    constexpr void reset() noexcept
+    {
+      view_ = nullptr;
+      start_ = 0;
+      token_ = {};
+    }
+
+    const split_view * view_{nullptr};
+    std::size_t start_{0};
+    std::size_t end_{0};
+    std::string_view token_{};
+  };
+
+  using const_iterator = iterator;
+
+  /// Construct a range over the tokens of `input` split by `delim`.
+  /**
+   * \param[in] input the input string to be split
+   * \param[in] delim the delimiter used to split the input string
+   * \param[in] skip_empty skip empty tokens
+   */
+  constexpr split_view(std::string_view input, DelimiterT delim, bool skip_empty = false) noexcept
+  : input_(input), delim_(std::move(delim)), skip_empty_(skip_empty)
+  {}
+
+  constexpr iterator begin() const noexcept
+  {
+    return iterator(this);
+  }
+
+  constexpr iterator end() const noexcept
+  {
+    return iterator();
+  }
+
+  /// Check whether the range yields no tokens.
+  constexpr bool empty() const noexcept
+  {
+    return begin() == end();
+  }
+
+private:
+  std::string_view input_;
+  DelimiterT delim_;
+  bool skip_empty_;
+};
+
+/// @cond
+// Hold compiled delimiters by reference so that their search tables are not rebuilt.
+split_view(std::string_view, const compiled_delimiter &)
+-> split_view<const compiled_delimiter &>;
+split_view(std::string_view, const compiled_delimiter &, bool)
+-> split_view<const compiled_delimiter &>;
+// Treat string literal delimiters as separators rather than pointers.
+split_view(std::string_view, const char *)->split_view<std::string_view>;
+split_view(std::string_view, const char *, bool)->split_view<std::string_view>;
+/// @endcond
+
+/// Count the tokens of a specified input split by a delimiter.
+/**
+ * Usable in constant expressions, typically to size the result of rcpputils::split_array().
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the delimiter used to split the input string
+ * \param[in] skip_empty do not count empty tokens
+ * \return The number of tokens rcpputils::split() would return.
+ */
+constexpr std::size_t
+split_count(std::string_view input, char delim, bool skip_empty = false) noexcept
+{
+  const split_view view(input, delim, skip_empty);
+  std::size_t count = 0;
+  for (auto it = view.begin(); it != view.end(); ++it) {
+    ++count;
+  }
+  return count;
+}
+
+/// Split a specified input into a fixed number of tokens, possibly at compile time.
+/**
+ * With a constant input, e.g. a string literal, the tokens are computed during compilation:
+ *
+ * \code
+ * constexpr std::string_view name = "/my_ns/my_node";
+ * constexpr auto parts =
+ *   rcpputils::split_array<rcpputils::split_count(name, '/', true)>(name, '/', true);
+ * static_assert(parts[1] == "my_node");
+ * \endcode
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the delimiter used to split the input string
+ * \param[in] skip_empty skip empty tokens
+ * \tparam N the number of tokens, as returned by rcpputils::split_count()
+ * \return An array of tokens pointing into the input.
+ * \throws std::length_error if the input does not have exactly N tokens, which makes constant
+ *   evaluation fail.
+ */
+template<std::size_t N>
+constexpr std::array<std::string_view, N>
+split_array(std::string_view input, char delim, bool skip_empty = false)
+{
+  std::array<std::string_view, N> result{};
+  std::size_t count = 0;
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    if (count == N) {
+      throw std::length_error("split_array: input has more tokens than requested");
+    }
+    result[count++] = token;
+  }
+  if (count != N) {
+    throw std::length_error("split_array: input has fewer tokens than requested");
+  }
+  return result;
+}
+
 /// @cond
 /// Split a specified input into tokens using a delimiter and a type erased insert iterator.
 /**
@@ -62,14 +519,8 @@ template<
 void
 split(const std::string & input, char delim, InsertIterator & it, bool skip_empty = false)
 {
-  std::stringstream ss;
-  ss.str(input);
-  std::string item;
-  while (std::getline(ss, item, delim)) {
-    if (skip_empty && item == "") {
-      continue;
-    }
-    it = item;
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    it = std::string(token);
   }
 }
 /// @endcond
@@ -87,10 +538,268 @@ inline std::vector<std::string>
 split(const std::string & input, char delim, bool skip_empty = false)
 {
   std::vector<std::string> result;
-  auto it = std::back_inserter(result);
-  split(input, delim, it, skip_empty);
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    result.emplace_back(token);
+  }
+  return result;
+}
+
+/// Split a specified input into tokens on any of a set of delimiter characters.
+/**
+ * The returned vector will contain the tokens split from the input.
+ * Delimiters are searched for with vectorized instructions when available, which makes this
+ * overload suitable for large inputs such as configuration blobs or long path lists.
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delims the set of delimiters used to split the input string
+ * \param[in] skip_empty remove empty strings from the returned vector
+ * \return A vector of tokens.
+ */
+inline std::vector<std::string>
+split(const std::string & input, const delimiter_set & delims, bool skip_empty = false)
+{
+  std::vector<std::string> result;
+  for (const std::string_view token : split_view(input, delims, skip_empty)) {
+    result.emplace_back(token);
+  }
+  return result;
+}
+
+/// Split a specified input into tokens using a multi-character delimiter.
+/**
+ * The returned vector will contain the tokens split from the input.
+ * Occurrences of the delimiter are matched left to right without overlapping.
+ * An empty delimiter never matches, so the whole input is returned as a single token.
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the delimiter used to split the input string
+ * \param[in] skip_empty remove empty strings from the returned vector
+ * \return A vector of tokens.
+ */
+inline std::vector<std::string>
+split(const std::string & input, std::string_view delim, bool skip_empty = false)
+{
+  std::vector<std::string> result;
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    result.emplace_back(token);
+  }
+  return result;
+}
+
+/// Split a specified input into tokens using a precompiled multi-character delimiter.
+/**
+ * Prefer this overload over the `std::string_view` one when the same, possibly long, delimiter
+ * is used to split many inputs.
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the compiled delimiter used to split the input string
+ * \param[in] skip_empty remove empty strings from the returned vector
+ * \return A vector of tokens.
+ */
+inline std::vector<std::string>
+split(const std::string & input, const compiled_delimiter & delim, bool skip_empty = false)
+{
+  std::vector<std::string> result;
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    result.emplace_back(token);
+  }
   return result;
 }
+
+/// Split a specified input into views of its tokens, reusing caller-owned storage.
+/**
+ * `out` is cleared and refilled, so its capacity is retained across calls and no allocation
+ * happens once it is large enough.
+ * The tokens point into `input`, which must outlive them.
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the delimiter used to split the input string; any delimiter type accepted by
+ *   rcpputils::split_view may be used
+ * \param[out] out the container to be filled with the tokens
+ * \param[in] skip_empty skip empty tokens
+ */
+template<typename DelimiterT>
+void
+split_into(
+  std::string_view input, const DelimiterT & delim, std::vector<std::string_view> & out,
+  bool skip_empty = false)
+{
+  out.clear();
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    out.push_back(token);
+  }
+}
+
+/// Split a specified input into tokens, reusing caller-owned strings.
+/**
+ * Existing elements of `out` are overwritten in place, so their buffers are reused when large
+ * enough; new elements are only constructed if there are more tokens than before.
+ * Surplus elements are erased, while the capacity of `out` itself is retained.
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the delimiter used to split the input string; any delimiter type accepted by
+ *   rcpputils::split_view may be used
+ * \param[out] out the container to be filled with the tokens
+ * \param[in] skip_empty skip empty tokens
+ */
+template<typename DelimiterT>
+void
+split_into(
+  std::string_view input, const DelimiterT & delim, std::vector<std::string> & out,
+  bool skip_empty = false)
+{
+  std::size_t count = 0;
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    if (count < out.size()) {
+      out[count].assign(token);
+    } else {
+      out.emplace_back(token);
+    }
+    ++count;
+  }
+  out.erase(out.begin() + count, out.end());
+}
+
+/// Split a specified input into at most `max_tokens` tokens, scanning from the front.
+/**
+ * Scanning stops as soon as `max_tokens - 1` tokens have been produced; the rest of the input,
+ * starting at the next token, is then returned verbatim as the last token.
+ * If the input has at most `max_tokens` tokens, the result is the same as rcpputils::split().
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the delimiter used to split the input string; any delimiter type accepted by
+ *   rcpputils::split_view may be used
+ * \param[in] max_tokens the maximum number of tokens to return
+ * \param[in] skip_empty skip empty tokens, including before the remainder
+ * \return A vector of at most `max_tokens` tokens.
+ */
+template<typename DelimiterT>
+std::vector<std::string>
+split_n(
+  std::string_view input, const DelimiterT & delim, std::size_t max_tokens,
+  bool skip_empty = false)
+{
+  std::vector<std::string> result;
+  if (0u == max_tokens) {
+    return result;
+  }
+  const split_view view(input, delim, skip_empty);
+  for (auto it = view.begin(); it != view.end(); ++it) {
+    if (result.size() + 1u == max_tokens) {
+      auto next = it;
+      if (++next == view.end()) {
+        result.emplace_back(*it);
+      } else {
+        result.emplace_back(input.substr(static_cast<std::size_t>(it->data() - input.data())));
+      }
+      break;
+    }
+    result.emplace_back(*it);
+  }
+  return result;
+}
+
+/// Split a specified input into at most `max_tokens` tokens, scanning from the back.
+/**
+ * Scanning stops as soon as `max_tokens - 1` tokens have been produced from the end of the
+ * input; the rest of the input, up to the end of the preceding token, is then returned verbatim
+ * as the first token.
+ * When `max_tokens` is 1 the whole input is returned verbatim, including any trailing delimiter,
+ * as with split_n(), unless `skip_empty` is set.
+ * Tokens are returned in input order.
+ * If the input has at most `max_tokens` tokens, the result is the same as rcpputils::split().
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delim the delimiter used to split the input string, either a `char`, a
+ *   rcpputils::delimiter_set, a string or a rcpputils::compiled_delimiter
+ * \param[in] max_tokens the maximum number of tokens to return
+ * \param[in] skip_empty skip empty tokens, including after the remainder
+ * \return A vector of at most `max_tokens` tokens.
+ */
+template<typename DelimiterT>
+std::vector<std::string>
+rsplit_n(
+  std::string_view input, const DelimiterT & delim, std::size_t max_tokens,
+  bool skip_empty = false)
+{
+  std::vector<std::string> result;
+  if (0u == max_tokens || input.empty()) {
+    return result;
+  }
+  const std::size_t delim_size = detail::delimiter_size(delim);
+  const auto ends_with_delimiter = [&delim, delim_size](std::string_view str) {
+      return delim_size > 0u && str.size() >= delim_size &&
+             0u == detail::rfind_delimiter(str.substr(str.size() - delim_size), delim);
+    };
+  std::string_view rest = input;
+  // As with split(), a trailing delimiter does not produce a trailing empty token.
+  if (ends_with_delimiter(rest)) {
+    rest.remove_suffix(delim_size);
+  }
+  for (;;) {
+    const bool last_token = result.size() + 1u == max_tokens;
+    const std::size_t pos = last_token ?
+      std::string_view::npos : detail::rfind_delimiter(rest, delim);
+    if (std::string_view::npos == pos) {
+      if (last_token && result.empty() && !skip_empty) {
+        // The remainder reaches the end of the input, so as with split_n() it keeps the
+        // trailing delimiter.
+        rest = input;
+      }
+      while (skip_empty && ends_with_delimiter(rest)) {
+        rest.remove_suffix(delim_size);
+      }
+      if (!skip_empty || !rest.empty()) {
+        result.emplace_back(rest);
+      }
+      break;
+    }
+    const std::string_view token = rest.substr(pos + delim_size);
+    rest = rest.substr(0, pos);
+    if (!skip_empty || !token.empty()) {
+      result.emplace_back(token);
+    }
+  }
+  std::reverse(result.begin(), result.end());
+  return result;
+}
+
+/// Default minimum number of input bytes given to each thread by split_parallel().
+constexpr std::size_t split_parallel_min_chunk_size = 256 * 1024;
+
+/// Split a large input into tokens using multiple threads.
+/**
+ * The input is cut into chunks which end on delimiter boundaries, the chunks are split
+ * concurrently and the resulting tokens are concatenated in order.
+ * The result is identical to that of the equivalent rcpputils::split() call.
+ * Inputs too small to be given at least `min_chunk_size` bytes per thread use fewer threads, and
+ * are split on the calling thread if only one chunk would be produced.
+ *
+ * \param[in] input the input string to be split
+ * \param[in] delims the set of delimiters used to split the input string
+ * \param[in] skip_empty remove empty strings from the returned vector
+ * \param[in] max_threads the maximum number of threads to use, or 0 to use one per hardware thread
+ * \param[in] min_chunk_size the minimum number of bytes to split per thread
+ * \return A vector of tokens.
+ */
+RCPPUTILS_PUBLIC
+std::vector<std::string>
+split_parallel(
+  std::string_view input, const delimiter_set & delims, bool skip_empty = false,
+  std::size_t max_threads = 0, std::size_t min_chunk_size = split_parallel_min_chunk_size);
+
+/// Split a large input into tokens on a single delimiter using multiple threads.
+/**
+ * \see split_parallel(std::string_view, const delimiter_set &, bool, std::size_t, std::size_t)
+ */
+inline std::vector<std::string>
+split_parallel(
+  std::string_view input, char delim, bool skip_empty = false,
+  std::size_t max_threads = 0, std::size_t min_chunk_size = split_parallel_min_chunk_size)
+{
+  return split_parallel(
+    input, delimiter_set(std::string_view(&delim, 1)), skip_empty, max_threads, min_chunk_size);
+}
 }  // namespace rcpputils
 
 #endif  // RCPPUTILS__SPLIT_HPP_
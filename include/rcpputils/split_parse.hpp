@@ -0,0 +1,183 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file split_parse.hpp
+ * \brief Split a string by provided delimiter and parse each token as a number.
+ */
+
+#ifndef RCPPUTILS__SPLIT_PARSE_HPP_
+#define RCPPUTILS__SPLIT_PARSE_HPP_
+
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "rcpputils/split.hpp"
+#include "rcpputils/tl_expected/expected.hpp"
+
+namespace rcpputils
+{
+
+/// Description of a token which failed to parse.
+struct split_parse_error
+{
+  /// std::errc::invalid_argument if the token is not a number,
+  /// std::errc::result_out_of_range if it does not fit the requested type, or
+  /// std::errc::value_too_large if the output buffer is too small for all tokens.
+  std::errc error;
+  /// Offset of the token in the input.
+  std::size_t offset;
+  /// The offending token.
+  std::string_view token;
+};
+
+namespace detail
+{
+constexpr std::string_view
+trim_whitespace(std::string_view token) noexcept
+{
+  constexpr std::string_view whitespace = " \t\n\v\f\r";
+  const std::size_t first = token.find_first_not_of(whitespace);
+  if (std::string_view::npos == first) {
+    return {};
+  }
+  return token.substr(first, token.find_last_not_of(whitespace) - first + 1);
+}
+
+template<typename T>
+std::errc
+parse_number(std::string_view token, T & value) noexcept
+{
+  token = trim_whitespace(token);
+  if (token.size() > 1 && '+' == token.front() && '-' != token[1]) {
+    token.remove_prefix(1);
+  }
+  if (token.empty()) {
+    return std::errc::invalid_argument;
+  }
+  const char * const last = token.data() + token.size();
+#if defined(__cpp_lib_to_chars) || defined(_MSC_VER)
+  const auto result = std::from_chars(token.data(), last, value);
+#else
+  std::from_chars_result result{token.data(), std::errc::invalid_argument};
+  if constexpr (std::is_integral_v<T>) {
+    result = std::from_chars(token.data(), last, value);
+  } else {
+    // The standard library lacks floating point std::from_chars; parse a terminated copy.
+    char buffer[128];
+    if (token.size() >= sizeof(buffer)) {
+      return std::errc::invalid_argument;
+    }
+    token.copy(buffer, token.size());
+    buffer[token.size()] = '\0';
+    char * end = nullptr;
+    errno = 0;
+    const long double parsed = std::strtold(buffer, &end);
+    result.ptr = token.data() + (end - buffer);
+    if (end == buffer) {
+      result.ec = std::errc::invalid_argument;
+    } else if (ERANGE == errno || parsed > std::numeric_limits<T>::max() ||
+      parsed < std::numeric_limits<T>::lowest())
+    {
+      result.ec = std::errc::result_out_of_range;
+    } else {
+      result.ec = std::errc();
+      value = static_cast<T>(parsed);
+    }
+  }
+#endif
+  if (std::errc() != result.ec) {
+    return result.ec;
+  }
+  return result.ptr == last ? std::errc() : std::errc::invalid_argument;
+}
+}  // namespace detail
+
+/// Split a specified input by a delimiter and parse each token into a caller-provided buffer.
+/**
+ * Tokens are parsed with std::from_chars in the same pass that finds them, without allocating.
+ * Leading and trailing whitespace around each token, as well as a leading `+`, is ignored.
+ *
+ * \param[in] input the input string to be split and parsed
+ * \param[in] delim the delimiter used to split the input string; any delimiter type accepted by
+ *   rcpputils::split_view may be used
+ * \param[out] out the buffer receiving the parsed values
+ * \param[in] capacity the number of elements available in `out`
+ * \param[in] skip_empty skip empty tokens instead of reporting them as errors
+ * \tparam T the arithmetic type to parse each token as
+ * \return The number of values written, or a description of the first token that failed.
+ */
+template<typename T, typename DelimiterT>
+tl::expected<std::size_t, split_parse_error>
+split_parse_into(
+  std::string_view input, const DelimiterT & delim, T * out, std::size_t capacity,
+  bool skip_empty = false)
+{
+  static_assert(
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+    "split_parse only supports integral and floating point types");
+  std::size_t count = 0;
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    const auto offset = static_cast<std::size_t>(token.data() - input.data());
+    if (count == capacity) {
+      return tl::make_unexpected(split_parse_error{std::errc::value_too_large, offset, token});
+    }
+    const std::errc error = detail::parse_number(token, out[count]);
+    if (std::errc() != error) {
+      return tl::make_unexpected(split_parse_error{error, offset, token});
+    }
+    ++count;
+  }
+  return count;
+}
+
+/// Split a specified input by a delimiter and parse each token as a number.
+/**
+ * \param[in] input the input string to be split and parsed
+ * \param[in] delim the delimiter used to split the input string; any delimiter type accepted by
+ *   rcpputils::split_view may be used
+ * \param[in] skip_empty skip empty tokens instead of reporting them as errors
+ * \tparam T the arithmetic type to parse each token as
+ * \return The parsed values, or a description of the first token that failed.
+ * \sa split_parse_into()
+ */
+template<typename T, typename DelimiterT>
+tl::expected<std::vector<T>, split_parse_error>
+split_parse(std::string_view input, const DelimiterT & delim, bool skip_empty = false)
+{
+  static_assert(
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+    "split_parse only supports integral and floating point types");
+  std::vector<T> result;
+  for (const std::string_view token : split_view(input, delim, skip_empty)) {
+    T value{};
+    const std::errc error = detail::parse_number(token, value);
+    if (std::errc() != error) {
+      return tl::make_unexpected(
+        split_parse_error{error, static_cast<std::size_t>(token.data() - input.data()), token});
+    }
+    result.push_back(value);
+  }
+  return result;
+}
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__SPLIT_PARSE_HPP_
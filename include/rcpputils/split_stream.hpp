@@ -0,0 +1,209 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file split_stream.hpp
+ * \brief Split streamed input by provided delimiters with bounded memory.
+ */
+
+#ifndef RCPPUTILS__SPLIT_STREAM_HPP_
+#define RCPPUTILS__SPLIT_STREAM_HPP_
+
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "rcpputils/split.hpp"
+#include "rcpputils/visibility_control.hpp"
+
+namespace rcpputils
+{
+
+/// Tokenizer reading its input incrementally from a file descriptor or a std::istream.
+/**
+ * Input is read into a fixed-size buffer which is refilled as tokens are consumed, so memory
+ * usage does not depend on the size of the input.
+ * As a consequence, a single token may not be longer than the buffer, excluding its delimiter.
+ *
+ * When reading from a regular file descriptor, the file may instead be memory mapped.
+ * Tokens then point directly into the mapping and may have any length, and pages which have
+ * been consumed are released back to the operating system as the tokenizer advances.
+ *
+ * The tokenization rules match those of rcpputils::split().
+ * Each token returned by next() is only valid until the following call to next().
+ */
+class stream_splitter
+{
+public:
+  /// Default size of the read buffer, in bytes.
+  static constexpr std::size_t default_buffer_size = 64 * 1024;
+
+  /// Input iterator over the remaining tokens of a stream_splitter.
+  class iterator
+  {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view *;
+    using reference = const std::string_view &;
+
+    /// Construct a past-the-end iterator.
+    iterator() = default;
+
+    reference operator*() const noexcept
+    {
+      return token_;
+    }
+
+    pointer operator->() const noexcept
+    {
+      return &token_;
+    }
+
+    iterator & operator++()
+    {
+      if (!splitter_->next(token_)) {
+        splitter_ = nullptr;
+      }
+      return *this;
+    }
+
+    friend bool operator==(const iterator & lhs, const iterator & rhs) noexcept
+    {
+      return lhs.splitter_ == rhs.splitter_;
+    }
+
+    friend bool operator!=(const iterator & lhs, const iterator & rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+private:
+    friend class stream_splitter;
+
+    explicit iterator(stream_splitter * splitter)
+    : splitter_(splitter)
+    {
+      ++(*this);
+    }
+
+    stream_splitter * splitter_{nullptr};
+    std::string_view token_{};
+  };
+
+  /// Split the contents of a std::istream.
+  /**
+   * \param[in] input the stream to read from; it must outlive the tokenizer
+   * \param[in] delims the delimiters used to split the input
+   * \param[in] skip_empty skip empty tokens
+   * \param[in] buffer_size the size of the read buffer, which bounds the token length
+   * \throws std::invalid_argument if buffer_size is zero
+   */
+  RCPPUTILS_PUBLIC
+  stream_splitter(
+    std::istream & input, const delimiter_set & delims, bool skip_empty = false,
+    std::size_t buffer_size = default_buffer_size);
+
+  /// Split the contents of a std::istream on a single delimiter character.
+  RCPPUTILS_PUBLIC
+  stream_splitter(
+    std::istream & input, char delim, bool skip_empty = false,
+    std::size_t buffer_size = default_buffer_size);
+
+  /// Split the contents of a file descriptor, starting at its current offset.
+  /**
+   * The file descriptor is not closed by the tokenizer.
+   *
+   * \param[in] fd the file descriptor to read from
+   * \param[in] delims the delimiters used to split the input
+   * \param[in] skip_empty skip empty tokens
+   * \param[in] buffer_size the size of the read buffer, which bounds the token length
+   * \param[in] use_mmap memory map the file instead of reading it, if it is a regular file and
+   *   the platform supports it; reading is used otherwise
+   * \throws std::invalid_argument if buffer_size is zero
+   */
+  RCPPUTILS_PUBLIC
+  stream_splitter(
+    int fd, const delimiter_set & delims, bool skip_empty = false,
+    std::size_t buffer_size = default_buffer_size, bool use_mmap = false);
+
+  /// Split the contents of a file descriptor on a single delimiter character.
+  RCPPUTILS_PUBLIC
+  stream_splitter(
+    int fd, char delim, bool skip_empty = false,
+    std::size_t buffer_size = default_buffer_size, bool use_mmap = false);
+
+  /// Move a tokenizer; the moved-from tokenizer produces no more tokens.
+  RCPPUTILS_PUBLIC
+  stream_splitter(stream_splitter && other) noexcept;
+
+  RCPPUTILS_PUBLIC
+  stream_splitter & operator=(stream_splitter && other) noexcept;
+
+  RCPPUTILS_PUBLIC
+  ~stream_splitter();
+
+  /// Get the next token.
+  /**
+   * \param[out] token the next token, valid until the following call
+   * \return true if a token was produced, false once the input is exhausted or if the tokenizer
+   *   was moved from.
+   * \throws std::length_error if a token does not fit in the read buffer
+   * \throws std::runtime_error if reading from the input fails
+   */
+  RCPPUTILS_PUBLIC
+  bool
+  next(std::string_view & token);
+
+  /// Check whether the input is currently memory mapped; false if the tokenizer was moved from.
+  RCPPUTILS_PUBLIC
+  bool
+  is_mapped() const noexcept;
+
+  /// Begin iterating over the remaining tokens; this reads the first of them.
+  iterator begin()
+  {
+    return iterator(this);
+  }
+
+  iterator end()
+  {
+    return iterator();
+  }
+
+  /// Invoke a callable with each remaining token.
+  /**
+   * \param[in] callback a callable accepting a `std::string_view`
+   */
+  template<typename CallbackT>
+  void
+  for_each(CallbackT && callback)
+  {
+    std::string_view token;
+    while (next(token)) {
+      callback(token);
+    }
+  }
+
+private:
+  struct impl;
+  std::unique_ptr<impl> impl_;
+};
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__SPLIT_STREAM_HPP_
@@ -0,0 +1,188 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file string_template.hpp
+ * \brief Templates with named placeholders, parsed once and rendered many times.
+ */
+
+#ifndef RCPPUTILS__STRING_TEMPLATE_HPP_
+#define RCPPUTILS__STRING_TEMPLATE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/visibility_control.hpp"
+
+namespace rcpputils
+{
+
+/// Resolve placeholders to the value of the environment variable of the same name.
+/**
+ * Unset variables resolve to an empty string.
+ * \sa rcpputils::get_env_var()
+ */
+struct env_resolver
+{
+  /// Get the value of the environment variable `name`, or "" if it is not set.
+  /**
+   * \throws std::runtime_error on error
+   */
+  RCPPUTILS_PUBLIC
+  std::string
+  operator()(const std::string & name) const;
+};
+
+/// A string with named `{placeholders}`, parsed once and rendered many times.
+/**
+ * Placeholders are written as `{name}`; literal braces are written as `{{` and `}}`.
+ * Parsing splits the template into a list of literal and placeholder segments, so rendering
+ * only looks up each distinct placeholder once, computes the exact size of the result and
+ * appends the segments to the output, without searching the template again.
+ *
+ * Values are supplied either as a vector ordered like keys(), as a map from name to value, or
+ * as a callable which takes a name and returns anything convertible to `std::string_view`,
+ * such as rcpputils::env_resolver.
+ *
+ * \code
+ * const rcpputils::string_template log_name("{node}_{stamp}.log");
+ * std::string buffer;
+ * for (...) {
+ *   buffer.clear();
+ *   log_name.render(std::vector<std::string_view>{node, stamp}, buffer);
+ * }
+ * \endcode
+ */
+class string_template
+{
+public:
+  /// Parse a template.
+  /**
+   * \param[in] text the template text
+   * \throws std::invalid_argument if a placeholder is empty or unterminated, or a `}` is
+   *   unmatched
+   */
+  RCPPUTILS_PUBLIC
+  explicit string_template(std::string_view text);
+
+  /// Get the distinct placeholder names, in order of first appearance.
+  const std::vector<std::string> &
+  keys() const noexcept
+  {
+    return keys_;
+  }
+
+  /// Render the template, appending the result to `output`.
+  /**
+   * \param[in] values the value of each placeholder, in the order of keys()
+   * \param[inout] output the string the result is appended to; its capacity is reused
+   * \throws std::invalid_argument if the number of values differs from the number of keys
+   */
+  RCPPUTILS_PUBLIC
+  void
+  render(const std::vector<std::string_view> & values, std::string & output) const;
+
+  /// Render the template, appending the result to `output`.
+  /**
+   * \param[in] values a map from placeholder name to value, such as
+   *   `std::unordered_map<std::string, std::string>`, or a callable taking a placeholder name as
+   *   `const std::string &` and returning its value
+   * \param[inout] output the string the result is appended to; its capacity is reused
+   * \throws std::out_of_range if a map lacks the value of a placeholder
+   */
+  template<typename ValuesT>
+  void
+  render(const ValuesT & values, std::string & output) const
+  {
+    if constexpr (std::is_invocable_v<const ValuesT &, const std::string &>) {
+      resolve_and_render(values, output);
+    } else {
+      resolve_and_render(
+        [&values](const std::string & key) -> const auto & {return values.at(key);}, output);
+    }
+  }
+
+  /// Render the template.
+  /**
+   * \param[in] values the placeholder values, as accepted by the appending overloads
+   * \return The rendered string.
+   */
+  template<typename ValuesT>
+  std::string
+  render(const ValuesT & values) const
+  {
+    std::string output;
+    render(values, output);
+    return output;
+  }
+
+private:
+  // Number of placeholder values resolved on the stack rather than the heap.
+  static constexpr std::size_t inline_values = 16;
+
+  struct segment
+  {
+    // Offset and length in literals_, or the index into keys_ if key is set.
+    std::size_t offset;
+    std::size_t length;
+    bool key;
+  };
+
+  template<typename ResolverT>
+  void
+  resolve_and_render(const ResolverT & resolve, std::string & output) const
+  {
+    // Values returned by value, e.g. by env_resolver, must outlive the views rendered from them.
+    using value_type = std::decay_t<std::invoke_result_t<const ResolverT &, const std::string &>>;
+    static_assert(
+      std::is_convertible_v<const value_type &, std::string_view>,
+      "placeholder values must be convertible to std::string_view");
+    using holder_type = std::conditional_t<
+      std::is_reference_v<std::invoke_result_t<const ResolverT &, const std::string &>>,
+      std::string_view, value_type>;
+    if (keys_.size() <= inline_values) {
+      std::array<holder_type, inline_values> held;
+      std::array<std::string_view, inline_values> views;
+      for (std::size_t i = 0; i < keys_.size(); ++i) {
+        held[i] = resolve(keys_[i]);
+        views[i] = held[i];
+      }
+      render_values(views.data(), output);
+    } else {
+      std::vector<holder_type> held;
+      held.reserve(keys_.size());
+      for (const std::string & key : keys_) {
+        held.emplace_back(resolve(key));
+      }
+      const std::vector<std::string_view> views(held.begin(), held.end());
+      render_values(views.data(), output);
+    }
+  }
+
+  RCPPUTILS_PUBLIC
+  void
+  render_values(const std::string_view * values, std::string & output) const;
+
+  std::string literals_;
+  std::vector<segment> segments_;
+  std::vector<std::string> keys_;
+};
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__STRING_TEMPLATE_HPP_
@@ -15,11 +15,254 @@
 #ifndef RCPPUTILS__TIME_HPP_
 #define RCPPUTILS__TIME_HPP_
 
+#include <charconv>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "rcpputils/tl_expected/expected.hpp"
+#include "rcpputils/visibility_control.hpp"
 
 namespace rcpputils
 {
 
+namespace detail
+{
+// Overflow checked arithmetic, storing the result modulo 2^N on overflow like the GCC builtins.
+template<typename T>
+constexpr bool
+multiply_overflow(T a, T b, T & result) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(a, b, &result);
+#else
+  using unsigned_type = std::make_unsigned_t<T>;
+  result = static_cast<T>(static_cast<unsigned_type>(a) * static_cast<unsigned_type>(b));
+  if (T{0} == a || T{0} == b) {
+    return false;
+  }
+  if constexpr (std::is_signed_v<T>) {
+    constexpr T min = std::numeric_limits<T>::min();
+    if ((T{-1} == a && min == b) || (T{-1} == b && min == a)) {
+      return true;
+    }
+  }
+  return result / b != a;
+#endif
+}
+
+template<typename T>
+constexpr bool
+add_overflow(T a, T b, T & result) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(a, b, &result);
+#else
+  using unsigned_type = std::make_unsigned_t<T>;
+  result = static_cast<T>(static_cast<unsigned_type>(a) + static_cast<unsigned_type>(b));
+  if constexpr (std::is_signed_v<T>) {
+    return (a < T{0}) == (b < T{0}) && (result < T{0}) != (a < T{0});
+  } else {
+    return result < a;
+  }
+#endif
+}
+
+// floor(a * b / d) for a < d, computed without overflowing even when a * b does not fit.
+template<typename T>
+constexpr T
+multiply_divide_remainder(T a, T b, T d) noexcept
+{
+  static_assert(std::is_unsigned_v<T>, "multiply_divide_remainder requires an unsigned type");
+  T product = 0;
+  if (!multiply_overflow(a, b, product)) {
+    return product / d;
+  }
+  // Long multiplication of a by the bits of b, keeping the partial product reduced modulo d.
+  // As a and the reduced partial product are less than d, this never overflows.
+  T quotient = 0;
+  T remainder = 0;
+  for (int bit = std::numeric_limits<T>::digits - 1; bit >= 0; --bit) {
+    quotient *= 2;
+    if (remainder >= d - remainder) {
+      remainder -= d - remainder;
+      ++quotient;
+    } else {
+      remainder *= 2;
+    }
+    if ((b >> bit) & T{1}) {
+      if (remainder >= d - a) {
+        remainder -= d - a;
+        ++quotient;
+      } else {
+        remainder += a;
+      }
+    }
+  }
+  return quotient;
+}
+
+enum class duration_cast_status
+{
+  ok,
+  too_large,
+  too_small,
+  not_a_number,
+};
+
+// Convert a duration like std::chrono::duration_cast, reporting whether the result overflowed.
+// Integral durations are converted with integer arithmetic only, so the result is exact, and is
+// stored modulo 2^N on overflow; floating point arithmetic is only used for floating point reps.
+template<typename ToDurationT, typename RepT, typename PeriodT>
+constexpr duration_cast_status
+exact_duration_cast(
+  const std::chrono::duration<RepT, PeriodT> & time, typename ToDurationT::rep & result) noexcept
+{
+  using to_rep = typename ToDurationT::rep;
+  using ratio = std::ratio_divide<PeriodT, typename ToDurationT::period>;
+  if constexpr (std::is_integral_v<RepT> && std::is_integral_v<to_rep>) {
+    // Work on the magnitude so that a signed count can convert to the full range of an unsigned
+    // rep; arithmetic modulo 2^N keeps the wrapped result correct on overflow.
+    using wide = std::uintmax_t;
+    const RepT count = time.count();
+    bool negative = false;
+    if constexpr (std::is_signed_v<RepT>) {
+      negative = count < RepT{0};
+    }
+    const wide magnitude = negative ? wide{0} - static_cast<wide>(count) : static_cast<wide>(count);
+    constexpr wide num = static_cast<wide>(ratio::num);
+    constexpr wide den = static_cast<wide>(ratio::den);
+    bool overflow = false;
+    wide value = magnitude;
+    if constexpr (1 != ratio::den) {
+      // Divide first so that magnitude * num may overflow only if the result does.
+      wide quotient = 0;
+      overflow |= multiply_overflow(magnitude / den, num, quotient);
+      overflow |= add_overflow(
+        quotient, multiply_divide_remainder(magnitude % den, num, den), value);
+    } else if constexpr (1 != ratio::num) {
+      overflow |= multiply_overflow(magnitude, num, value);
+    }
+    if (negative) {
+      constexpr wide limit = wide{0} - static_cast<wide>(std::numeric_limits<to_rep>::min());
+      overflow |= value > limit;
+      result = static_cast<to_rep>(wide{0} - value);
+    } else {
+      overflow |= value > static_cast<wide>(std::numeric_limits<to_rep>::max());
+      result = static_cast<to_rep>(value);
+    }
+    if (!overflow) {
+      return duration_cast_status::ok;
+    }
+    return negative ? duration_cast_status::too_small : duration_cast_status::too_large;
+  } else {
+    if constexpr (std::is_floating_point_v<RepT> && std::is_integral_v<to_rep>) {
+      if (std::isnan(time.count())) {
+        return duration_cast_status::not_a_number;
+      }
+    }
+    using common = std::common_type_t<RepT, to_rep, std::intmax_t>;
+    const common value = static_cast<common>(time.count()) * static_cast<common>(ratio::num) /
+      static_cast<common>(ratio::den);
+    if constexpr (std::is_integral_v<to_rep>) {
+      // Powers of two, which are exact in floating point unlike the maximum itself.
+      constexpr common upper = static_cast<common>(std::numeric_limits<to_rep>::max() / 2 + 1) * 2;
+      if (!(value < upper)) {
+        return duration_cast_status::too_large;
+      }
+      if constexpr (std::is_signed_v<to_rep>) {
+        if (value < static_cast<common>(std::numeric_limits<to_rep>::min())) {
+          return duration_cast_status::too_small;
+        }
+      } else {
+        if (!(value > common{-1})) {
+          return duration_cast_status::too_small;
+        }
+      }
+    }
+    result = static_cast<to_rep>(value);
+    return duration_cast_status::ok;
+  }
+}
+}  // namespace detail
+
+/// Convert a duration to another duration type, reporting overflow instead of invoking undefined
+/// behavior.
+/**
+ * Conversions between integral durations use integer arithmetic and overflow checks only, so
+ * they are exact over the whole range of both types.
+ *
+ * \param[in] time The duration to convert.
+ * \tparam ToDurationT The std::chrono::duration type to convert to.
+ * \return The converted duration, truncated toward zero as by std::chrono::duration_cast, or
+ *   std::errc::result_out_of_range if it is not representable, or std::errc::invalid_argument if
+ *   `time` is not a number.
+ */
+template<typename ToDurationT, typename RepT, typename PeriodT>
+constexpr tl::expected<ToDurationT, std::errc>
+checked_duration_cast(const std::chrono::duration<RepT, PeriodT> & time) noexcept
+{
+  typename ToDurationT::rep result{};
+  switch (detail::exact_duration_cast<ToDurationT>(time, result)) {
+    case detail::duration_cast_status::ok:
+      return ToDurationT(result);
+    case detail::duration_cast_status::not_a_number:
+      return tl::make_unexpected(std::errc::invalid_argument);
+    default:
+      return tl::make_unexpected(std::errc::result_out_of_range);
+  }
+}
+
+/// Convert a duration to another duration type, clamping it to the range of the target type.
+/**
+ * \param[in] time The duration to convert.
+ * \tparam ToDurationT The std::chrono::duration type to convert to.
+ * \return The converted duration, or ToDurationT::max() or ToDurationT::min() if it is too large
+ *   or too small, or zero if `time` is not a number.
+ */
+template<typename ToDurationT, typename RepT, typename PeriodT>
+constexpr ToDurationT
+saturating_duration_cast(const std::chrono::duration<RepT, PeriodT> & time) noexcept
+{
+  typename ToDurationT::rep result{};
+  switch (detail::exact_duration_cast<ToDurationT>(time, result)) {
+    case detail::duration_cast_status::ok:
+      return ToDurationT(result);
+    case detail::duration_cast_status::too_large:
+      return ToDurationT::max();
+    case detail::duration_cast_status::too_small:
+      return ToDurationT::min();
+    default:
+      return ToDurationT::zero();
+  }
+}
+
+/// Convert an integral duration to another integral duration type, wrapping around on overflow.
+/**
+ * \param[in] time The duration to convert.
+ * \tparam ToDurationT The std::chrono::duration type to convert to.
+ * \return The converted duration, modulo 2^N where N is the number of bits of its rep.
+ */
+template<typename ToDurationT, typename RepT, typename PeriodT>
+constexpr ToDurationT
+wrapping_duration_cast(const std::chrono::duration<RepT, PeriodT> & time) noexcept
+{
+  static_assert(
+    std::is_integral_v<RepT> && std::is_integral_v<typename ToDurationT::rep>,
+    "wrapping_duration_cast requires integral durations");
+  typename ToDurationT::rep result{};
+  detail::exact_duration_cast<ToDurationT>(time, result);
+  return ToDurationT(result);
+}
+
 /// Convert to std::chrono::nanoseconds.
 /**
  * This function help to convert from std::chrono::duration to std::chrono::nanoseconds and throw
@@ -28,30 +271,187 @@ namespace rcpputils
  * \param[in] time The time to be converted to std::chrono::nanoseconds.
  * \return std::chrono::nanoseconds.
  * \throws std::invalid_argument if time is bigger than std::chrono::nanoseconds::max() or less than
- * std::chrono::nanoseconds::min().
+ * std::chrono::nanoseconds::min(), or if it is not a number.
+ * \sa checked_duration_cast() and saturating_duration_cast() for conversions which do not throw.
  */
 template<typename DurationRepT, typename DurationT>
 std::chrono::nanoseconds convert_to_nanoseconds(
   const std::chrono::duration<DurationRepT, DurationT> & time)
 {
-  constexpr auto ns_max_as_double =
-    std::chrono::duration_cast<std::chrono::duration<double, std::chrono::nanoseconds::period>>(
-    std::chrono::nanoseconds::max());
-  if (time > ns_max_as_double) {
-    throw std::invalid_argument{
-            "time must be less than std::chrono::nanoseconds::max()"};
+  std::chrono::nanoseconds::rep result{};
+  switch (detail::exact_duration_cast<std::chrono::nanoseconds>(time, result)) {
+    case detail::duration_cast_status::ok:
+      return std::chrono::nanoseconds(result);
+    case detail::duration_cast_status::too_small:
+      throw std::invalid_argument{
+              "time must be bigger than std::chrono::nanoseconds::min()"};
+    case detail::duration_cast_status::not_a_number:
+      throw std::invalid_argument{"time must not be NaN"};
+    default:
+      throw std::invalid_argument{
+              "time must be less than std::chrono::nanoseconds::max()"};
+  }
+}
+
+/// Parse a duration such as "1.5ms", "250us", "2h" or "1h30m".
+/**
+ * The text is an optional sign followed by one or more decimal numbers, each with an optional
+ * fraction and a unit suffix: `ns`, `us` (or `µs`), `ms`, `s`, `m` or `h`.
+ * "0" is accepted without a unit; whitespace is not accepted.
+ *
+ * Parsing does not allocate and uses exact integer arithmetic, truncating toward zero to whole
+ * nanoseconds; fractional digits beyond the 17th are ignored.
+ *
+ * \param[in] text the text to parse
+ * \return The duration, or std::errc::invalid_argument if the text is malformed, or
+ *   std::errc::result_out_of_range if the duration does not fit in std::chrono::nanoseconds.
+ */
+RCPPUTILS_PUBLIC
+tl::expected<std::chrono::nanoseconds, std::errc>
+parse_duration(std::string_view text) noexcept;
+
+/// The maximum number of characters written by format_duration().
+constexpr std::size_t max_duration_length = 25;
+
+/// Format a duration as text accepted by parse_duration(), without allocating.
+/**
+ * Durations shorter than a second use the largest unit of `ns`, `us` and `ms` below them, with a
+ * fraction if needed, e.g. "1.5ms".
+ * Longer durations are split into hours, minutes and seconds, e.g. "1h30m0s" or "2.25s".
+ * Zero is formatted as "0s".
+ *
+ * \param[in] first the beginning of the buffer to write to
+ * \param[in] last the end of the buffer to write to
+ * \param[in] time the duration to format
+ * \return As std::to_chars(): the end of the written text, or `last` and
+ *   std::errc::value_too_large if it does not fit; max_duration_length characters always fit.
+ */
+RCPPUTILS_PUBLIC
+std::to_chars_result
+format_duration(char * first, char * last, std::chrono::nanoseconds time) noexcept;
+
+/// Format a duration as text accepted by parse_duration().
+/**
+ * \sa format_duration(char *, char *, std::chrono::nanoseconds)
+ */
+RCPPUTILS_PUBLIC
+std::string
+format_duration(std::chrono::nanoseconds time);
+
+/// Sleep until a steady_clock time point, waking up more precisely than std::this_thread.
+/**
+ * The calling thread sleeps until `spin_margin` before `deadline`, using
+ * `clock_nanosleep(TIMER_ABSTIME)` on Linux and std::this_thread::sleep_until() elsewhere, and then
+ * spins until the deadline.
+ * This trades up to `spin_margin` of CPU time for not depending on the latency of the scheduler
+ * waking the thread up.
+ *
+ * \param[in] deadline the time to sleep until; the function returns immediately if it has passed
+ * \param[in] spin_margin how long before the deadline to stop sleeping and start spinning
+ */
+RCPPUTILS_PUBLIC
+void
+precise_sleep_until(
+  std::chrono::steady_clock::time_point deadline,
+  std::chrono::nanoseconds spin_margin = std::chrono::microseconds(100));
+
+/// Statistics about the cycles of a rate_loop.
+struct rate_loop_statistics
+{
+  /// The number of deadlines which were waited for, i.e. the calls to rate_loop::sleep().
+  std::uint64_t cycles{0};
+  /// The number of calls to rate_loop::sleep() made after the deadline of the cycle had passed.
+  std::uint64_t overruns{0};
+  /// The number of deadlines skipped because of overruns.
+  std::uint64_t missed_cycles{0};
+  /// The smallest, largest and mean lateness of waking up, over cycles which were not overrun.
+  std::chrono::nanoseconds min_jitter{std::chrono::nanoseconds::max()};
+  std::chrono::nanoseconds max_jitter{0};
+  std::chrono::nanoseconds mean_jitter{0};
+  /// The standard deviation of the lateness of waking up.
+  std::chrono::nanoseconds jitter_stddev{0};
+  /// The largest amount by which a cycle overran its deadline.
+  std::chrono::nanoseconds max_overrun{0};
+};
+
+/// Runs a loop at a fixed rate, on a schedule of absolute deadlines which does not drift.
+/**
+ * Deadlines are the start time plus a whole number of periods, so the time spent in the loop
+ * body and the lateness of waking up do not accumulate.
+ * Waiting uses precise_sleep_until().
+ *
+ * When the loop body overruns its deadline, sleep() returns immediately and the deadlines which
+ * passed entirely are skipped, keeping the phase of the schedule, rather than running a burst of
+ * cycles to catch up.
+ *
+ * \code
+ * rcpputils::rate_loop loop(std::chrono::milliseconds(1));
+ * while (running) {
+ *   control_step();
+ *   loop.sleep();
+ * }
+ * \endcode
+ */
+class rate_loop
+{
+public:
+  /// Start a schedule with the first deadline one period from now.
+  /**
+   * \param[in] period the interval between deadlines
+   * \param[in] spin_margin how long before each deadline to stop sleeping and start spinning
+   * \throws std::invalid_argument if `period` is not positive or `spin_margin` is negative
+   */
+  RCPPUTILS_PUBLIC
+  explicit rate_loop(
+    std::chrono::nanoseconds period,
+    std::chrono::nanoseconds spin_margin = std::chrono::microseconds(100));
+
+  /// Wait for the next deadline.
+  /**
+   * \return false if the deadline had already passed, in which case this returns immediately.
+   */
+  RCPPUTILS_PUBLIC
+  bool
+  sleep();
+
+  /// Restart the schedule with the next deadline one period from now.
+  RCPPUTILS_PUBLIC
+  void
+  reset();
+
+  /// Get the interval between deadlines.
+  std::chrono::nanoseconds
+  period() const noexcept
+  {
+    return period_;
   }
 
-  constexpr auto ns_min_as_double =
-    std::chrono::duration_cast<std::chrono::duration<double, std::chrono::nanoseconds::period>>(
-    std::chrono::nanoseconds::min());
-  if (time < ns_min_as_double) {
-    throw std::invalid_argument{
-            "time must be bigger than std::chrono::nanoseconds::min()"};
+  /// Get the deadline the next call to sleep() waits for.
+  std::chrono::steady_clock::time_point
+  next_deadline() const noexcept
+  {
+    return next_deadline_;
   }
 
-  return std::chrono::duration_cast<std::chrono::nanoseconds>(time);
-}
+  /// Get the statistics gathered since construction or the last call to reset_statistics().
+  RCPPUTILS_PUBLIC
+  rate_loop_statistics
+  statistics() const noexcept;
+
+  /// Clear the statistics.
+  RCPPUTILS_PUBLIC
+  void
+  reset_statistics() noexcept;
+
+private:
+  std::chrono::nanoseconds period_;
+  std::chrono::nanoseconds spin_margin_;
+  std::chrono::steady_clock::time_point next_deadline_;
+  rate_loop_statistics statistics_;
+  // Running mean and sum of squared deviations of the jitter in nanoseconds (Welford).
+  double jitter_mean_{0.0};
+  double jitter_m2_{0.0};
+};
 
 }  // namespace rcpputils
 
@@ -0,0 +1,80 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file tsc_clock.hpp
+ * \brief Steady clock reading the CPU timestamp counter directly.
+ */
+
+#ifndef RCPPUTILS__TSC_CLOCK_HPP_
+#define RCPPUTILS__TSC_CLOCK_HPP_
+
+#include <chrono>
+
+#include "rcpputils/visibility_control.hpp"
+
+namespace rcpputils
+{
+
+/// A steady clock reading the CPU timestamp counter, for very frequent timestamps.
+/**
+ * On x86 processors with an invariant TSC the clock reads it with `rdtsc`, and on AArch64 it
+ * reads the generic timer's virtual counter `cntvct_el0`, avoiding the system call or vDSO
+ * overhead of std::chrono::steady_clock.
+ * Counter ticks are converted to nanoseconds with a fixed point multiply and shift.
+ *
+ * The counter is calibrated against std::chrono::steady_clock on first use, which blocks for
+ * about 10 milliseconds on x86; call is_counter_based() during initialization to avoid paying
+ * for it on a time critical path.
+ * Its time points share the epoch of std::chrono::steady_clock and start out agreeing with it.
+ * The calibration is not refined afterwards, so the two clocks drift apart by the calibration
+ * error, typically around 10 ppm on x86 or tens of milliseconds per hour.
+ * Only compare tsc_clock time points with each other, or with steady_clock over short intervals.
+ *
+ * The counters of different cores may differ slightly, so each thread's readings are clamped to
+ * the latest time previously returned to it; a thread migrating to another core therefore never
+ * sees the clock go backwards, although it may briefly stand still.
+ *
+ * When no suitable counter is available, the clock falls back to std::chrono::steady_clock.
+ *
+ * This class satisfies the TrivialClock requirements of the C++ standard.
+ */
+class tsc_clock
+{
+public:
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<tsc_clock>;
+
+  static constexpr bool is_steady = true;
+
+  /// Get the current time.
+  RCPPUTILS_PUBLIC
+  static time_point
+  now() noexcept;
+
+  /// Whether the clock reads a hardware counter, rather than falling back to steady_clock.
+  RCPPUTILS_PUBLIC
+  static bool
+  is_counter_based() noexcept;
+
+  /// Get the calibrated frequency of the hardware counter in Hz, or 0 if it is not used.
+  RCPPUTILS_PUBLIC
+  static double
+  counter_frequency() noexcept;
+};
+
+}  // namespace rcpputils
+
+#endif  // RCPPUTILS__TSC_CLOCK_HPP_
@@ -0,0 +1,142 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+
+#include "rcpputils/coarse_clock.hpp"
+
+namespace rcpputils
+{
+
+namespace detail
+{
+cached_clock_state cached_clock_time;
+}  // namespace detail
+
+namespace
+{
+
+std::int64_t
+steady_nanoseconds() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+constexpr std::chrono::nanoseconds
+steady_clock_resolution() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::duration(1));
+}
+
+}  // namespace
+
+coarse_clock::time_point
+coarse_clock::now() noexcept
+{
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+  timespec ts;
+  if (0 == clock_gettime(CLOCK_MONOTONIC_COARSE, &ts)) {
+    return time_point(std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec));
+  }
+#endif
+  return time_point(std::chrono::steady_clock::now().time_since_epoch());
+}
+
+coarse_clock::duration
+coarse_clock::resolution() noexcept
+{
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+  timespec ts;
+  if (0 == clock_getres(CLOCK_MONOTONIC_COARSE, &ts)) {
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+  }
+#endif
+  return steady_clock_resolution();
+}
+
+cached_clock::duration
+cached_clock::resolution() noexcept
+{
+  const std::int64_t ticker_period =
+    detail::cached_clock_time.period.load(std::memory_order_relaxed);
+  return 0 != ticker_period ? duration(ticker_period) : steady_clock_resolution();
+}
+
+cached_clock::duration
+cached_clock::max_staleness() noexcept
+{
+  return duration(detail::cached_clock_time.period.load(std::memory_order_relaxed));
+}
+
+cached_clock::ticker::ticker(duration period)
+: period_(period)
+{
+  if (period <= duration::zero()) {
+    throw std::invalid_argument("cached_clock ticker period must be positive");
+  }
+  // The period doubles as the flag claiming the clock for this ticker.
+  std::int64_t expected = 0;
+  if (!detail::cached_clock_time.period.compare_exchange_strong(expected, period.count())) {
+    throw std::logic_error("a cached_clock ticker is already running");
+  }
+  detail::cached_clock_time.nanoseconds.store(steady_nanoseconds(), std::memory_order_relaxed);
+  try {
+    thread_ = std::thread(&ticker::run, this);
+  } catch (...) {
+    detail::cached_clock_time.nanoseconds.store(0, std::memory_order_relaxed);
+    detail::cached_clock_time.period.store(0, std::memory_order_relaxed);
+    throw;
+  }
+}
+
+cached_clock::ticker::~ticker()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  stop_requested_.notify_one();
+  thread_.join();
+  detail::cached_clock_time.nanoseconds.store(0, std::memory_order_relaxed);
+  detail::cached_clock_time.period.store(0, std::memory_order_relaxed);
+}
+
+void
+cached_clock::ticker::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto next = std::chrono::steady_clock::now() + period_;
+  while (!stop_requested_.wait_until(lock, next, [this] {return stop_;})) {
+    const auto now = std::chrono::steady_clock::now();
+    detail::cached_clock_time.nanoseconds.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count(),
+      std::memory_order_relaxed);
+    // Keep to the period's schedule, unless the thread fell behind by a whole period.
+    next += period_;
+    if (next <= now) {
+      next = now + period_;
+    }
+  }
+}
+
+}  // namespace rcpputils
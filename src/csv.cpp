@@ -0,0 +1,321 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+# define RCPPUTILS_CSV_HAVE_SSE2 1
+# include <emmintrin.h>
+# if defined(__GNUC__) || defined(__clang__)
+#  define RCPPUTILS_CSV_HAVE_AVX2 1
+#  include <immintrin.h>
+# endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+# define RCPPUTILS_CSV_HAVE_NEON 1
+# include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+#include "rcpputils/csv.hpp"
+
+namespace rcpputils
+{
+namespace
+{
+
+constexpr std::size_t kBlockSize = 64;
+
+// Bitmasks of the bytes of a 64-byte block; bit i corresponds to byte i.
+struct block_masks
+{
+  std::uint64_t quotes;
+  std::uint64_t structurals;
+};
+
+using classify_fn = block_masks (*)(const char * block, char delimiter, char quote);
+
+#if !defined(RCPPUTILS_CSV_HAVE_SSE2) && !defined(RCPPUTILS_CSV_HAVE_NEON)
+block_masks
+classify_scalar(const char * block, char delimiter, char quote)
+{
+  block_masks masks{0, 0};
+  for (std::size_t i = 0; i < kBlockSize; ++i) {
+    const char c = block[i];
+    masks.quotes |= static_cast<std::uint64_t>(c == quote) << i;
+    masks.structurals |= static_cast<std::uint64_t>(c == delimiter || c == '\n') << i;
+  }
+  return masks;
+}
+#endif
+
+#if defined(RCPPUTILS_CSV_HAVE_SSE2)
+block_masks
+classify_sse2(const char * block, char delimiter, char quote)
+{
+  const __m128i quotes = _mm_set1_epi8(quote);
+  const __m128i delimiters = _mm_set1_epi8(delimiter);
+  const __m128i newlines = _mm_set1_epi8('\n');
+  block_masks masks{0, 0};
+  for (std::size_t i = 0; i < kBlockSize; i += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i));
+    const auto quote_bits =
+      static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quotes)));
+    const auto structural_bits = static_cast<std::uint32_t>(
+      _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, delimiters), _mm_cmpeq_epi8(chunk, newlines))));
+    masks.quotes |= static_cast<std::uint64_t>(quote_bits) << i;
+    masks.structurals |= static_cast<std::uint64_t>(structural_bits) << i;
+  }
+  return masks;
+}
+#endif
+
+#if defined(RCPPUTILS_CSV_HAVE_AVX2)
+__attribute__((target("avx2")))
+block_masks
+classify_avx2(const char * block, char delimiter, char quote)
+{
+  const __m256i quotes = _mm256_set1_epi8(quote);
+  const __m256i delimiters = _mm256_set1_epi8(delimiter);
+  const __m256i newlines = _mm256_set1_epi8('\n');
+  block_masks masks{0, 0};
+  for (std::size_t i = 0; i < kBlockSize; i += 32) {
+    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + i));
+    const auto quote_bits =
+      static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, quotes)));
+    const auto structural_bits = static_cast<std::uint32_t>(
+      _mm256_movemask_epi8(
+        _mm256_or_si256(
+          _mm256_cmpeq_epi8(chunk, delimiters), _mm256_cmpeq_epi8(chunk, newlines))));
+    masks.quotes |= static_cast<std::uint64_t>(quote_bits) << i;
+    masks.structurals |= static_cast<std::uint64_t>(structural_bits) << i;
+  }
+  return masks;
+}
+#endif
+
+#if defined(RCPPUTILS_CSV_HAVE_NEON)
+std::uint64_t
+neon_movemask(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2, uint8x16_t m3)
+{
+  const uint8x16_t bits = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+  uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bits), vandq_u8(m1, bits));
+  const uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bits), vandq_u8(m3, bits));
+  sum0 = vpaddq_u8(sum0, sum1);
+  sum0 = vpaddq_u8(sum0, sum0);
+  return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+block_masks
+classify_neon(const char * block, char delimiter, char quote)
+{
+  const uint8x16_t quotes = vdupq_n_u8(static_cast<std::uint8_t>(quote));
+  const uint8x16_t delimiters = vdupq_n_u8(static_cast<std::uint8_t>(delimiter));
+  const uint8x16_t newlines = vdupq_n_u8('\n');
+  uint8x16_t chunks[4];
+  for (std::size_t i = 0; i < 4; ++i) {
+    chunks[i] = vld1q_u8(reinterpret_cast<const std::uint8_t *>(block + 16 * i));
+  }
+  uint8x16_t q[4];
+  uint8x16_t s[4];
+  for (std::size_t i = 0; i < 4; ++i) {
+    q[i] = vceqq_u8(chunks[i], quotes);
+    s[i] = vorrq_u8(vceqq_u8(chunks[i], delimiters), vceqq_u8(chunks[i], newlines));
+  }
+  return block_masks{
+    neon_movemask(q[0], q[1], q[2], q[3]),
+    neon_movemask(s[0], s[1], s[2], s[3])};
+}
+#endif
+
+classify_fn
+select_classify()
+{
+#if defined(RCPPUTILS_CSV_HAVE_AVX2)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return classify_avx2;
+  }
+#endif
+#if defined(RCPPUTILS_CSV_HAVE_SSE2)
+  return classify_sse2;
+#elif defined(RCPPUTILS_CSV_HAVE_NEON)
+  return classify_neon;
+#else
+  return classify_scalar;
+#endif
+}
+
+// Set every bit which has an odd number of set bits at or below it, i.e. inside quotes.
+std::uint64_t
+prefix_xor(std::uint64_t x)
+{
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+unsigned
+count_trailing_zeros(std::uint64_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;  // NOLINT(runtime/int): required by _BitScanForward64
+  _BitScanForward64(&index, mask);
+  return static_cast<unsigned>(index);
+#else
+  return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+}
+
+// Append the field of `size` bytes at `begin`, which ends a record if `line_end` is set.
+inline void
+push_field(
+  std::vector<csv_field> & fields, const char * begin, std::size_t size, bool line_end,
+  char quote)
+{
+  if (line_end && 0u != size && '\r' == begin[size - 1u]) {
+    --size;
+  }
+  // Fill the new element in place; building a temporary and copying it stalls on store
+  // forwarding, as the narrow stores of the flags are read back as part of a wide load.
+  csv_field & field = fields.emplace_back();
+  field.quote = quote;
+  if (size >= 2u && quote == begin[0] && quote == begin[size - 1u]) {
+    field.value = std::string_view(begin + 1, size - 2u);
+    field.quoted = true;
+    field.escaped = nullptr != std::memchr(field.value.data(), quote, field.value.size());
+  } else {
+    field.value = std::string_view(begin, size);
+  }
+}
+
+}  // namespace
+
+csv_reader::csv_reader(std::string_view input, char delimiter, char quote)
+: input_(input), delimiter_(delimiter), quote_(quote)
+{
+  if (delimiter == quote || '\n' == delimiter || '\r' == delimiter || '\n' == quote ||
+    '\r' == quote)
+  {
+    throw std::invalid_argument(
+            "csv_reader delimiter and quote must differ and must not be line breaks");
+  }
+}
+
+bool
+csv_reader::next_block()
+{
+  static const classify_fn classify = select_classify();
+  if (next_block_ >= input_.size()) {
+    return false;
+  }
+  block_masks masks;
+  if (input_.size() - next_block_ >= kBlockSize) {
+    masks = classify(input_.data() + next_block_, delimiter_, quote_);
+  } else {
+    // Pad the final partial block with NUL bytes, which are masked out if they are significant.
+    char tail[kBlockSize] = {};
+    std::memcpy(tail, input_.data() + next_block_, input_.size() - next_block_);
+    masks = classify(tail, delimiter_, quote_);
+    if ('\0' == delimiter_ || '\0' == quote_) {
+      const std::uint64_t valid = (std::uint64_t{1} << (input_.size() - next_block_)) - 1u;
+      masks.quotes &= valid;
+      masks.structurals &= valid;
+    }
+  }
+  const std::uint64_t inside = prefix_xor(masks.quotes) ^ in_quotes_;
+  in_quotes_ = 0u - (inside >> 63);
+  pending_ = masks.structurals & ~inside;
+  block_start_ = next_block_;
+  next_block_ += kBlockSize;
+  return true;
+}
+
+bool
+csv_reader::next_record(std::vector<csv_field> & fields)
+{
+  fields.clear();
+  if (done_) {
+    return false;
+  }
+  // The per field loop works on local copies of the reader state, as the compiler cannot tell
+  // that appending to `fields` leaves the members unchanged and would reload them every time.
+  const char * const data = input_.data();
+  const char quote = quote_;
+  std::uint64_t pending = pending_;
+  std::size_t block_start = block_start_;
+  std::size_t field_start = field_start_;
+  for (;;) {
+    while (0u == pending) {
+      if (!next_block()) {
+        done_ = true;
+        field_start_ = input_.size();
+        if (field_start < input_.size() || !fields.empty()) {
+          push_field(fields, data + field_start, input_.size() - field_start, false, quote);
+          return true;
+        }
+        return false;
+      }
+      pending = pending_;
+      block_start = block_start_;
+    }
+    const std::size_t pos = block_start + count_trailing_zeros(pending);
+    pending &= pending - 1u;
+    const bool line_end = '\n' == data[pos];
+    push_field(fields, data + field_start, pos - field_start, line_end, quote);
+    field_start = pos + 1;
+    if (line_end) {
+      if (1u == fields.size() && !fields[0].quoted && fields[0].value.empty()) {
+        fields.clear();
+        continue;
+      }
+      pending_ = pending;
+      block_start_ = block_start;
+      field_start_ = field_start;
+      return true;
+    }
+  }
+}
+
+bool
+csv_reader::next_record(std::vector<std::string> & fields)
+{
+  if (!next_record(scratch_)) {
+    fields.clear();
+    return false;
+  }
+  fields.resize(scratch_.size());
+  for (std::size_t i = 0; i < scratch_.size(); ++i) {
+    fields[i].clear();
+    scratch_[i].append_unescaped(fields[i]);
+  }
+  return true;
+}
+
+}  // namespace rcpputils
@@ -0,0 +1,213 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+# define RCPPUTILS_ENDIAN_HAVE_SSSE3 1
+# define RCPPUTILS_ENDIAN_HAVE_AVX2 1
+# define RCPPUTILS_ENDIAN_TARGET(isa) __attribute__((target(isa)))
+# include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+// MSVC accepts SSSE3 and AVX2 intrinsics without per function target attributes.
+# define RCPPUTILS_ENDIAN_HAVE_SSSE3 1
+# define RCPPUTILS_ENDIAN_HAVE_AVX2 1
+# define RCPPUTILS_ENDIAN_TARGET(isa)
+# include <immintrin.h>
+# include <intrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+# define RCPPUTILS_ENDIAN_HAVE_NEON 1
+# include <arm_neon.h>
+#endif
+
+#include "rcpputils/endian.hpp"
+
+namespace rcpputils
+{
+namespace detail
+{
+namespace
+{
+
+using byteswap_fn = void (*)(const std::uint8_t * src, std::uint8_t * dst, std::size_t count);
+
+struct byteswap_kernels
+{
+  byteswap_fn swap16;
+  byteswap_fn swap32;
+  byteswap_fn swap64;
+};
+
+template<typename T>
+void
+byteswap_scalar(const std::uint8_t * src, std::uint8_t * dst, std::size_t count)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    T value;
+    std::memcpy(&value, src + i * sizeof(T), sizeof(T));
+    value = byteswap_unsigned(value);
+    std::memcpy(dst + i * sizeof(T), &value, sizeof(T));
+  }
+}
+
+#if defined(RCPPUTILS_ENDIAN_HAVE_SSSE3)
+// The pshufb control reversing the bytes of each Size byte element of a 16 byte vector.
+template<std::size_t Size>
+RCPPUTILS_ENDIAN_TARGET("ssse3")
+__m128i
+reverse_mask()
+{
+  alignas(16) std::uint8_t mask[16];
+  for (std::size_t i = 0; i < 16; ++i) {
+    mask[i] = static_cast<std::uint8_t>(i / Size * Size + (Size - 1 - i % Size));
+  }
+  return _mm_load_si128(reinterpret_cast<const __m128i *>(mask));
+}
+
+template<std::size_t Size>
+RCPPUTILS_ENDIAN_TARGET("ssse3")
+void
+byteswap_ssse3(const std::uint8_t * src, std::uint8_t * dst, std::size_t count)
+{
+  const __m128i mask = reverse_mask<Size>();
+  const std::size_t bytes = count * Size;
+  std::size_t i = 0;
+  for (; i + 16 <= bytes; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(block, mask));
+  }
+  byteswap_scalar<typename unsigned_of_size<Size>::type>(src + i, dst + i, (bytes - i) / Size);
+}
+#endif
+
+#if defined(RCPPUTILS_ENDIAN_HAVE_AVX2)
+template<std::size_t Size>
+RCPPUTILS_ENDIAN_TARGET("avx2")
+void
+byteswap_avx2(const std::uint8_t * src, std::uint8_t * dst, std::size_t count)
+{
+  // vpshufb shuffles within each 128-bit lane, so the same control applies to both lanes.
+  const __m256i mask = _mm256_broadcastsi128_si256(reverse_mask<Size>());
+  const std::size_t bytes = count * Size;
+  std::size_t i = 0;
+  for (; i + 64 <= bytes; i += 64) {
+    const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(first, mask));
+    _mm256_storeu_si256(
+      reinterpret_cast<__m256i *>(dst + i + 32), _mm256_shuffle_epi8(second, mask));
+  }
+  byteswap_ssse3<Size>(src + i, dst + i, (bytes - i) / Size);
+}
+#endif
+
+#if defined(RCPPUTILS_ENDIAN_HAVE_NEON)
+template<std::size_t Size>
+void
+byteswap_neon(const std::uint8_t * src, std::uint8_t * dst, std::size_t count)
+{
+  const std::size_t bytes = count * Size;
+  std::size_t i = 0;
+  for (; i + 16 <= bytes; i += 16) {
+    const uint8x16_t block = vld1q_u8(src + i);
+    if constexpr (Size == 2) {
+      vst1q_u8(dst + i, vrev16q_u8(block));
+    } else if constexpr (Size == 4) {
+      vst1q_u8(dst + i, vrev32q_u8(block));
+    } else {
+      vst1q_u8(dst + i, vrev64q_u8(block));
+    }
+  }
+  byteswap_scalar<typename unsigned_of_size<Size>::type>(src + i, dst + i, (bytes - i) / Size);
+}
+#endif
+
+#if defined(RCPPUTILS_ENDIAN_HAVE_AVX2)
+struct x86_features
+{
+  bool ssse3;
+  bool avx2;
+};
+
+x86_features
+detect_x86_features()
+{
+# if defined(_MSC_VER) && !defined(__clang__)
+  int registers[4];
+  __cpuid(registers, 0);
+  const int max_leaf = registers[0];
+  __cpuid(registers, 1);
+  const bool ssse3 = 0 != (registers[2] & (1 << 9));
+  // AVX state must also be enabled by the operating system, as reported by XGETBV.
+  const bool osxsave = 0 != (registers[2] & (1 << 27));
+  const bool avx = 0 != (registers[2] & (1 << 28));
+  bool avx2 = false;
+  if (max_leaf >= 7 && osxsave && avx && 6u == (_xgetbv(0) & 6u)) {
+    __cpuidex(registers, 7, 0);
+    avx2 = 0 != (registers[1] & (1 << 5));
+  }
+  return {ssse3, avx2};
+# else
+  __builtin_cpu_init();
+  return {0 != __builtin_cpu_supports("ssse3"), 0 != __builtin_cpu_supports("avx2")};
+# endif
+}
+#endif
+
+byteswap_kernels
+select_byteswap_kernels()
+{
+#if defined(RCPPUTILS_ENDIAN_HAVE_AVX2)
+  const x86_features features = detect_x86_features();
+  if (features.avx2) {
+    return {byteswap_avx2<2>, byteswap_avx2<4>, byteswap_avx2<8>};
+  }
+  if (features.ssse3) {
+    return {byteswap_ssse3<2>, byteswap_ssse3<4>, byteswap_ssse3<8>};
+  }
+#elif defined(RCPPUTILS_ENDIAN_HAVE_NEON)
+  return {byteswap_neon<2>, byteswap_neon<4>, byteswap_neon<8>};
+#endif
+  return {
+    byteswap_scalar<std::uint16_t>, byteswap_scalar<std::uint32_t>,
+    byteswap_scalar<std::uint64_t>};
+}
+
+}  // namespace
+
+void
+byteswap_elements(const void * src, void * dst, std::size_t size, std::size_t count) noexcept
+{
+  static const byteswap_kernels kernels = select_byteswap_kernels();
+  const auto * in = static_cast<const std::uint8_t *>(src);
+  auto * out = static_cast<std::uint8_t *>(dst);
+  switch (size) {
+    case 2:
+      kernels.swap16(in, out, count);
+      break;
+    case 4:
+      kernels.swap32(in, out, count);
+      break;
+    case 8:
+      kernels.swap64(in, out, count);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace detail
+}  // namespace rcpputils
@@ -221,9 +221,9 @@ path path::filename() const
 
 path path::extension() const
 {
-  const char * delimiter = ".";
-  auto split_fname = rcpputils::split(this->string(), *delimiter);
-  return split_fname.size() == 1 ? path("") : path("." + split_fname.back());
+  // Only the last element is needed, so avoid tokenizing the whole path.
+  auto split_fname = rcpputils::rsplit_n(this->string(), '.', 2);
+  return split_fname.size() < 2 ? path("") : path("." + split_fname.back());
 }
 
 path path::operator/(const std::string & other) const
@@ -0,0 +1,157 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/find_and_replace.hpp"
+
+namespace rcpputils
+{
+namespace
+{
+constexpr std::uint32_t kNone = std::numeric_limits<std::uint32_t>::max();
+}  // namespace
+
+multi_replacer::multi_replacer(
+  const std::vector<std::pair<std::string, std::string>> & replacements)
+: replacements_(replacements)
+{
+  // Characters which appear in no pattern all share class 0, which keeps the table small.
+  for (const auto & replacement : replacements_) {
+    if (replacement.first.empty()) {
+      throw std::invalid_argument("multi_replacer cannot find an empty string");
+    }
+    for (const char c : replacement.first) {
+      auto & cls = char_class_[static_cast<unsigned char>(c)];
+      if (0u == cls) {
+        cls = static_cast<std::uint16_t>(class_count_++);
+      }
+    }
+  }
+  const std::size_t k = class_count_;
+
+  // Build the trie.
+  transitions_.assign(k, kNone);
+  depth_.assign(1, 0u);
+  match_.assign(1, kNone);
+  for (std::size_t index = 0; index < replacements_.size(); ++index) {
+    std::uint32_t state = 0;
+    for (const char c : replacements_[index].first) {
+      const std::size_t slot = state * k + char_class_[static_cast<unsigned char>(c)];
+      if (kNone == transitions_[slot]) {
+        transitions_[slot] = static_cast<std::uint32_t>(depth_.size());
+        transitions_.resize(transitions_.size() + k, kNone);
+        depth_.push_back(depth_[state] + 1u);
+        match_.push_back(kNone);
+      }
+      state = transitions_[slot];
+    }
+    if (kNone != match_[state]) {
+      throw std::invalid_argument(
+              "multi_replacer got duplicate find string '" + replacements_[index].first + "'");
+    }
+    match_[state] = static_cast<std::uint32_t>(index);
+  }
+
+  // Turn the trie into a complete DFA breadth first, following failure links for missing
+  // transitions, and let each state inherit the longest match of its failure state.
+  std::vector<std::uint32_t> failure(depth_.size(), 0u);
+  std::queue<std::uint32_t> queue;
+  for (std::size_t cls = 0; cls < k; ++cls) {
+    if (kNone == transitions_[cls]) {
+      transitions_[cls] = 0u;
+    } else {
+      queue.push(transitions_[cls]);
+    }
+  }
+  while (!queue.empty()) {
+    const std::uint32_t state = queue.front();
+    queue.pop();
+    if (kNone == match_[state]) {
+      match_[state] = match_[failure[state]];
+    }
+    for (std::size_t cls = 0; cls < k; ++cls) {
+      const std::size_t slot = state * k + cls;
+      const std::uint32_t fallback = transitions_[failure[state] * k + cls];
+      if (kNone == transitions_[slot]) {
+        transitions_[slot] = fallback;
+      } else {
+        failure[transitions_[slot]] = fallback;
+        queue.push(transitions_[slot]);
+      }
+    }
+  }
+}
+
+std::string
+multi_replacer::apply(std::string_view input) const
+{
+  std::string output;
+  apply(input, output);
+  return output;
+}
+
+void
+multi_replacer::apply(std::string_view input, std::string & output) const
+{
+  output.reserve(output.size() + input.size());
+  const std::size_t k = class_count_;
+  std::size_t i = 0;
+  std::size_t emitted = 0;
+  std::uint32_t state = 0;
+  // Best match found so far, which is committed once no match can start at or before it.
+  std::uint32_t candidate = kNone;
+  std::size_t candidate_start = 0;
+  std::size_t candidate_length = 0;
+  for (;;) {
+    if (i < input.size()) {
+      state = transitions_[state * k + char_class_[static_cast<unsigned char>(input[i])]];
+      ++i;
+      const std::uint32_t match = match_[state];
+      if (kNone != match) {
+        const std::size_t length = replacements_[match].first.size();
+        const std::size_t start = i - length;
+        if (kNone == candidate || start < candidate_start ||
+          (start == candidate_start && length > candidate_length))
+        {
+          candidate = match;
+          candidate_start = start;
+          candidate_length = length;
+        }
+      }
+      // Any later match must begin within the prefix currently tracked by the automaton.
+      if (kNone == candidate || i - depth_[state] <= candidate_start) {
+        continue;
+      }
+    } else if (kNone == candidate) {
+      break;
+    }
+    output.append(input.substr(emitted, candidate_start - emitted));
+    output.append(replacements_[candidate].second);
+    emitted = i = candidate_start + candidate_length;
+    state = 0;
+    candidate = kNone;
+  }
+  output.append(input.substr(emitted));
+}
+
+}  // namespace rcpputils
@@ -0,0 +1,102 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _WIN32
+#include <limits.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#endif
+
+#include "rcpputils/joined_view.hpp"
+
+namespace rcpputils
+{
+
+#ifndef _WIN32
+namespace
+{
+#ifdef IOV_MAX
+constexpr std::size_t kIovMax = IOV_MAX;
+#else
+constexpr std::size_t kIovMax = 16;
+#endif
+
+// Drop the first `written` bytes from the iovecs, along with any which are now empty.
+void
+consume(iovec *& iov, std::size_t & count, std::size_t written)
+{
+  while (count > 0u && written >= iov->iov_len) {
+    written -= iov->iov_len;
+    ++iov;
+    --count;
+  }
+  if (written > 0u) {
+    iov->iov_base = static_cast<char *>(iov->iov_base) + written;
+    iov->iov_len -= written;
+  }
+}
+
+template<typename WriteT>
+std::size_t
+write_all(int fd, iovec * iov, std::size_t count, WriteT && write, const char * what)
+{
+  std::size_t total = 0;
+  consume(iov, count, 0u);
+  while (count > 0u) {
+    const ssize_t written = write(iov, static_cast<int>(std::min(count, kIovMax)), total);
+    if (written < 0) {
+      if (EAGAIN == errno || EWOULDBLOCK == errno) {
+        // Non-blocking descriptor; wait until it can take more data.
+        pollfd pfd{fd, POLLOUT, 0};
+        if (::poll(&pfd, 1, -1) < 0 && EINTR != errno) {
+          throw std::system_error(errno, std::generic_category(), what);
+        }
+      } else if (EINTR != errno) {
+        throw std::system_error(errno, std::generic_category(), what);
+      }
+      continue;
+    }
+    total += static_cast<std::size_t>(written);
+    consume(iov, count, static_cast<std::size_t>(written));
+  }
+  return total;
+}
+}  // namespace
+
+std::size_t
+writev_all(int fd, iovec * iov, std::size_t count)
+{
+  return write_all(
+    fd, iov, count, [fd](const iovec * batch, int size, std::size_t) {
+      return ::writev(fd, batch, size);
+    }, "writev_all failed to write");
+}
+
+std::size_t
+pwritev_all(int fd, iovec * iov, std::size_t count, off_t offset)
+{
+  return write_all(
+    fd, iov, count, [fd, offset](const iovec * batch, int size, std::size_t total) {
+      return ::pwritev(fd, batch, size, offset + static_cast<off_t>(total));
+    }, "pwritev_all failed to write");
+}
+#endif
+
+}  // namespace rcpputils
@@ -0,0 +1,278 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+# define RCPPUTILS_SPLIT_HAVE_SSE2 1
+# include <emmintrin.h>
+# if defined(__GNUC__) || defined(__clang__)
+#  define RCPPUTILS_SPLIT_HAVE_AVX2 1
+#  include <immintrin.h>
+# endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+# define RCPPUTILS_SPLIT_HAVE_NEON 1
+# include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+#include "rcpputils/split.hpp"
+
+namespace rcpputils
+{
+namespace detail
+{
+namespace
+{
+
+using find_first_of_fn =
+  std::size_t (*)(const char * data, std::size_t size, const delimiter_set & delims);
+
+std::size_t
+find_first_of_scalar(const char * data, std::size_t size, const delimiter_set & delims)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    if (delims.contains(data[i])) {
+      return i;
+    }
+  }
+  return size;
+}
+
+#if defined(RCPPUTILS_SPLIT_HAVE_SSE2) || defined(RCPPUTILS_SPLIT_HAVE_AVX2)
+inline unsigned
+count_trailing_zeros(std::uint32_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;  // NOLINT(runtime/int): required by _BitScanForward
+  _BitScanForward(&index, mask);
+  return static_cast<unsigned>(index);
+#else
+  return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+#if defined(RCPPUTILS_SPLIT_HAVE_SSE2)
+std::size_t
+find_first_of_sse2(const char * data, std::size_t size, const delimiter_set & delims)
+{
+  const std::string_view chars = delims.chars();
+  if (chars.empty()) {
+    return find_first_of_scalar(data, size, delims);
+  }
+  __m128i needles[delimiter_set::max_vectorized_size];
+  for (std::size_t k = 0; k < chars.size(); ++k) {
+    needles[k] = _mm_set1_epi8(chars[k]);
+  }
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    __m128i matches = _mm_cmpeq_epi8(block, needles[0]);
+    for (std::size_t k = 1; k < chars.size(); ++k) {
+      matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, needles[k]));
+    }
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+    if (mask != 0) {
+      return i + count_trailing_zeros(mask);
+    }
+  }
+  return i + find_first_of_scalar(data + i, size - i, delims);
+}
+#endif
+
+#if defined(RCPPUTILS_SPLIT_HAVE_AVX2)
+__attribute__((target("avx2")))
+std::size_t
+find_first_of_avx2(const char * data, std::size_t size, const delimiter_set & delims)
+{
+  const std::string_view chars = delims.chars();
+  if (chars.empty()) {
+    return find_first_of_scalar(data, size, delims);
+  }
+  __m256i needles[delimiter_set::max_vectorized_size];
+  for (std::size_t k = 0; k < chars.size(); ++k) {
+    needles[k] = _mm256_set1_epi8(chars[k]);
+  }
+  std::size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+    __m256i matches = _mm256_cmpeq_epi8(block, needles[0]);
+    for (std::size_t k = 1; k < chars.size(); ++k) {
+      matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, needles[k]));
+    }
+    const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+    if (mask != 0) {
+      return i + count_trailing_zeros(mask);
+    }
+  }
+  return i + find_first_of_sse2(data + i, size - i, delims);
+}
+#endif
+
+#if defined(RCPPUTILS_SPLIT_HAVE_NEON)
+std::size_t
+find_first_of_neon(const char * data, std::size_t size, const delimiter_set & delims)
+{
+  const std::string_view chars = delims.chars();
+  if (chars.empty()) {
+    return find_first_of_scalar(data, size, delims);
+  }
+  uint8x16_t needles[delimiter_set::max_vectorized_size];
+  for (std::size_t k = 0; k < chars.size(); ++k) {
+    needles[k] = vdupq_n_u8(static_cast<std::uint8_t>(chars[k]));
+  }
+  std::size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t block = vld1q_u8(reinterpret_cast<const std::uint8_t *>(data + i));
+    uint8x16_t matches = vceqq_u8(block, needles[0]);
+    for (std::size_t k = 1; k < chars.size(); ++k) {
+      matches = vorrq_u8(matches, vceqq_u8(block, needles[k]));
+    }
+    if (vmaxvq_u8(matches) != 0) {
+      // NEON has no movemask; the match is known to be within this block.
+      return i + find_first_of_scalar(data + i, 16, delims);
+    }
+  }
+  return i + find_first_of_scalar(data + i, size - i, delims);
+}
+#endif
+
+find_first_of_fn
+select_find_first_of()
+{
+#if defined(RCPPUTILS_SPLIT_HAVE_AVX2)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return find_first_of_avx2;
+  }
+#endif
+#if defined(RCPPUTILS_SPLIT_HAVE_SSE2)
+  return find_first_of_sse2;
+#elif defined(RCPPUTILS_SPLIT_HAVE_NEON)
+  return find_first_of_neon;
+#else
+  return find_first_of_scalar;
+#endif
+}
+
+}  // namespace
+
+std::size_t
+find_first_of(std::string_view input, std::size_t pos, const delimiter_set & delims) noexcept
+{
+  if (pos >= input.size()) {
+    return std::string_view::npos;
+  }
+  if (delims.size() == 1) {
+    return input.find(delims.chars()[0], pos);
+  }
+  static const find_first_of_fn impl = select_find_first_of();
+  const std::size_t size = input.size() - pos;
+  const std::size_t offset = impl(input.data() + pos, size, delims);
+  return offset == size ? std::string_view::npos : pos + offset;
+}
+
+}  // namespace detail
+
+namespace
+{
+
+// Run `task(i)` for every chunk index, on the calling thread for the first one.
+template<typename TaskT>
+void
+for_each_chunk(std::size_t chunk_count, TaskT task)
+{
+  std::vector<std::future<void>> futures;
+  futures.reserve(chunk_count - 1u);
+  for (std::size_t i = 1; i < chunk_count; ++i) {
+    futures.push_back(std::async(std::launch::async, task, i));
+  }
+  task(0u);
+  for (auto & future : futures) {
+    future.get();
+  }
+}
+
+}  // namespace
+
+std::vector<std::string>
+split_parallel(
+  std::string_view input, const delimiter_set & delims, bool skip_empty,
+  std::size_t max_threads, std::size_t min_chunk_size)
+{
+  if (0u == max_threads) {
+    max_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const std::size_t chunk_count = std::clamp<std::size_t>(
+    input.size() / std::max<std::size_t>(1u, min_chunk_size), 1u, max_threads);
+
+  // Every chunk but the last ends right after a delimiter, so each one starts a new token and
+  // splitting it on its own drops nothing but the empty token after its final delimiter, exactly
+  // as splitting the whole input would.
+  std::vector<std::string_view> chunks;
+  std::size_t begin = 0;
+  for (std::size_t i = 1; i < chunk_count; ++i) {
+    const std::size_t nominal = std::max(begin, input.size() / chunk_count * i);
+    const std::size_t pos = detail::find_first_of(input, nominal, delims);
+    if (std::string_view::npos == pos) {
+      break;
+    }
+    chunks.push_back(input.substr(begin, pos + 1 - begin));
+    begin = pos + 1;
+  }
+  chunks.push_back(input.substr(begin));
+
+  std::vector<std::string> result;
+  if (1u == chunks.size()) {
+    for (const std::string_view token : split_view(input, delims, skip_empty)) {
+      result.emplace_back(token);
+    }
+    return result;
+  }
+
+  // Count the tokens of each chunk first, so that the result is sized once and every chunk can
+  // then construct its tokens in place without any serial concatenation.
+  std::vector<std::size_t> offsets(chunks.size() + 1u, 0u);
+  for_each_chunk(
+    chunks.size(), [&](std::size_t i) {
+      const split_view view(chunks[i], delims, skip_empty);
+      offsets[i + 1] = static_cast<std::size_t>(std::distance(view.begin(), view.end()));
+    });
+  for (std::size_t i = 1; i < offsets.size(); ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+  result.resize(offsets.back());
+  for_each_chunk(
+    chunks.size(), [&](std::size_t i) {
+      std::size_t index = offsets[i];
+      for (const std::string_view token : split_view(chunks[i], delims, skip_empty)) {
+        result[index++].assign(token);
+      }
+    });
+  return result;
+}
+
+}  // namespace rcpputils
@@ -0,0 +1,273 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <sys/types.h>
+#  include <unistd.h>
+#endif
+
+#include "rcpputils/split.hpp"
+#include "rcpputils/split_stream.hpp"
+
+namespace rcpputils
+{
+
+struct stream_splitter::impl
+{
+  impl(const delimiter_set & delims, bool skip_empty, std::size_t buffer_size)
+  : delims(delims), skip_empty(skip_empty), buffer_size(buffer_size)
+  {
+    if (0u == buffer_size) {
+      throw std::invalid_argument("stream_splitter buffer size must be greater than zero");
+    }
+  }
+
+  ~impl()
+  {
+#ifndef _WIN32
+    if (nullptr != map_data) {
+      munmap(const_cast<char *>(map_data), map_size);
+    }
+#endif
+  }
+
+  void
+  allocate_buffer()
+  {
+    buffer.resize(buffer_size);
+    data = buffer.data();
+  }
+
+  bool
+  try_map()
+  {
+#ifdef _WIN32
+    return false;
+#else
+    struct stat st;
+    if (0 != fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+      return false;
+    }
+    const off_t offset = lseek(fd, 0, SEEK_CUR);
+    if (offset < 0 || offset > st.st_size) {
+      return false;
+    }
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void * mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == mapping) {
+      return false;
+    }
+    madvise(mapping, size, MADV_SEQUENTIAL);
+    map_data = static_cast<const char *>(mapping);
+    map_size = size;
+    page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    data = map_data;
+    begin = scan = released = static_cast<std::size_t>(offset);
+    end = size;
+    eof = true;
+    return true;
+#endif
+  }
+
+  // Drop already consumed pages of a mapping so that resident memory stays bounded.
+  void
+  release_consumed() noexcept
+  {
+#ifndef _WIN32
+    if (nullptr == map_data || begin - released < buffer_size) {
+      return;
+    }
+    const std::size_t aligned = begin - begin % page_size;
+    if (aligned > released) {
+      const std::size_t first = released - released % page_size;
+      madvise(const_cast<char *>(map_data) + first, aligned - first, MADV_DONTNEED);
+      released = aligned;
+    }
+#endif
+  }
+
+  std::size_t
+  read_some(char * destination, std::size_t count)
+  {
+    if (nullptr != stream) {
+      stream->read(destination, static_cast<std::streamsize>(count));
+      if (stream->bad()) {
+        throw std::runtime_error("stream_splitter failed to read from stream");
+      }
+      return static_cast<std::size_t>(stream->gcount());
+    }
+    for (;;) {
+#ifdef _WIN32
+      const int ret = _read(fd, destination, static_cast<unsigned int>(count));
+#else
+      const ssize_t ret = ::read(fd, destination, count);
+#endif
+      if (ret >= 0) {
+        return static_cast<std::size_t>(ret);
+      }
+      if (EINTR != errno) {
+        throw std::system_error(errno, std::generic_category(), "stream_splitter failed to read");
+      }
+    }
+  }
+
+  // Read more input into the buffer.
+  // Returns false if the buffer is filled by a single token whose delimiter was read and consumed
+  // instead, in which case the whole buffer is the token.
+  bool
+  refill()
+  {
+    if (begin > 0) {
+      std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+      end -= begin;
+      scan -= begin;
+      begin = 0;
+    }
+    if (end == buffer.size()) {
+      // A token filling the buffer still fits if it is followed by a delimiter or the end of input.
+      char following;
+      if (0u == read_some(&following, 1)) {
+        eof = true;
+        return true;
+      }
+      if (delims.contains(following)) {
+        return false;
+      }
+      throw std::length_error(
+              "stream_splitter token is longer than the buffer size of " +
+              std::to_string(buffer.size()) + " bytes");
+    }
+    const std::size_t count = read_some(buffer.data() + end, buffer.size() - end);
+    if (0u == count) {
+      eof = true;
+    }
+    end += count;
+    return true;
+  }
+
+  bool
+  next(std::string_view & token)
+  {
+    release_consumed();
+    for (;;) {
+      const std::size_t pos = detail::find_first_of(std::string_view(data, end), scan, delims);
+      if (std::string_view::npos != pos) {
+        token = std::string_view(data + begin, pos - begin);
+        begin = scan = pos + 1;
+        if (skip_empty && token.empty()) {
+          continue;
+        }
+        return true;
+      }
+      scan = end;
+      if (eof) {
+        if (begin == end) {
+          return false;
+        }
+        token = std::string_view(data + begin, end - begin);
+        begin = end;
+        return true;
+      }
+      if (!refill()) {
+        token = std::string_view(data + begin, end - begin);
+        begin = scan = end;
+        return true;
+      }
+    }
+  }
+
+  delimiter_set delims;
+  bool skip_empty;
+  std::size_t buffer_size;
+
+  std::istream * stream{nullptr};
+  int fd{-1};
+
+  std::vector<char> buffer;
+  const char * data{nullptr};
+  // Unconsumed input is [begin, end); delimiters have already been searched for in [begin, scan).
+  std::size_t begin{0};
+  std::size_t scan{0};
+  std::size_t end{0};
+  bool eof{false};
+
+  const char * map_data{nullptr};
+  std::size_t map_size{0};
+  std::size_t page_size{1};
+  std::size_t released{0};
+};
+
+stream_splitter::stream_splitter(
+  std::istream & input, const delimiter_set & delims, bool skip_empty, std::size_t buffer_size)
+: impl_(std::make_unique<impl>(delims, skip_empty, buffer_size))
+{
+  impl_->stream = &input;
+  impl_->allocate_buffer();
+}
+
+stream_splitter::stream_splitter(
+  std::istream & input, char delim, bool skip_empty, std::size_t buffer_size)
+: stream_splitter(input, delimiter_set(std::string_view(&delim, 1)), skip_empty, buffer_size)
+{}
+
+stream_splitter::stream_splitter(
+  int fd, const delimiter_set & delims, bool skip_empty, std::size_t buffer_size, bool use_mmap)
+: impl_(std::make_unique<impl>(delims, skip_empty, buffer_size))
+{
+  impl_->fd = fd;
+  if (!use_mmap || !impl_->try_map()) {
+    impl_->allocate_buffer();
+  }
+}
+
+stream_splitter::stream_splitter(
+  int fd, char delim, bool skip_empty, std::size_t buffer_size, bool use_mmap)
+: stream_splitter(
+    fd, delimiter_set(std::string_view(&delim, 1)), skip_empty, buffer_size, use_mmap)
+{}
+
+stream_splitter::stream_splitter(stream_splitter && other) noexcept = default;
+
+stream_splitter & stream_splitter::operator=(stream_splitter && other) noexcept = default;
+
+stream_splitter::~stream_splitter() = default;
+
+bool
+stream_splitter::next(std::string_view & token)
+{
+  return nullptr != impl_ && impl_->next(token);
+}
+
+bool
+stream_splitter::is_mapped() const noexcept
+{
+  return nullptr != impl_ && nullptr != impl_->map_data;
+}
+
+}  // namespace rcpputils
@@ -0,0 +1,109 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rcpputils/env.hpp"
+#include "rcpputils/string_template.hpp"
+
+namespace rcpputils
+{
+
+std::string
+env_resolver::operator()(const std::string & name) const
+{
+  return get_env_var(name.c_str());
+}
+
+string_template::string_template(std::string_view text)
+{
+  literals_.reserve(text.size());
+  // Adjacent literal text, including unescaped braces, is merged into a single segment.
+  const auto append_literal = [this](std::string_view literal) {
+      if (!segments_.empty() && !segments_.back().key) {
+        segments_.back().length += literal.size();
+      } else {
+        segments_.push_back(segment{literals_.size(), literal.size(), false});
+      }
+      literals_.append(literal);
+    };
+  std::size_t pos = 0;
+  while (pos < text.size()) {
+    const std::size_t brace = text.find_first_of("{}", pos);
+    if (std::string_view::npos == brace) {
+      append_literal(text.substr(pos));
+      break;
+    }
+    append_literal(text.substr(pos, brace - pos));
+    if (brace + 1 < text.size() && text[brace + 1] == text[brace]) {
+      append_literal(text.substr(brace, 1));
+      pos = brace + 2;
+      continue;
+    }
+    if ('}' == text[brace]) {
+      throw std::invalid_argument(
+              "unmatched '}' at offset " + std::to_string(brace) + " of template");
+    }
+    const std::size_t close = text.find_first_of("{}", brace + 1);
+    if (std::string_view::npos == close || '{' == text[close]) {
+      throw std::invalid_argument(
+              "unterminated placeholder at offset " + std::to_string(brace) + " of template");
+    }
+    const std::string_view key = text.substr(brace + 1, close - brace - 1);
+    if (key.empty()) {
+      throw std::invalid_argument(
+              "empty placeholder at offset " + std::to_string(brace) + " of template");
+    }
+    const auto found = std::find(keys_.begin(), keys_.end(), key);
+    segments_.push_back(segment{static_cast<std::size_t>(found - keys_.begin()), 0, true});
+    if (found == keys_.end()) {
+      keys_.emplace_back(key);
+    }
+    pos = close + 1;
+  }
+}
+
+void
+string_template::render(const std::vector<std::string_view> & values, std::string & output) const
+{
+  if (values.size() != keys_.size()) {
+    throw std::invalid_argument(
+            "template has " + std::to_string(keys_.size()) + " placeholders but " +
+            std::to_string(values.size()) + " values were given");
+  }
+  render_values(values.data(), output);
+}
+
+void
+string_template::render_values(const std::string_view * values, std::string & output) const
+{
+  std::size_t size = literals_.size();
+  for (const segment & seg : segments_) {
+    if (seg.key) {
+      size += values[seg.offset].size();
+    }
+  }
+  output.reserve(output.size() + size);
+  const std::string_view literals = literals_;
+  for (const segment & seg : segments_) {
+    output.append(seg.key ? values[seg.offset] : literals.substr(seg.offset, seg.length));
+  }
+}
+
+}  // namespace rcpputils
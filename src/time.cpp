@@ -0,0 +1,385 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if defined(__linux__)
+#include <time.h>
+
+#include <cerrno>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+#include "rcpputils/time.hpp"
+
+namespace rcpputils
+{
+
+namespace
+{
+
+// Hint to the CPU that this is a spin-wait loop, to save power and yield to a sibling thread.
+inline void
+spin_pause() noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+  asm volatile ("yield");
+#endif
+}
+
+void
+sleep_until(std::chrono::steady_clock::time_point deadline)
+{
+#if defined(__linux__)
+  // steady_clock is CLOCK_MONOTONIC on Linux, so its time points can be passed directly.
+  const auto since_epoch = deadline.time_since_epoch();
+  if (since_epoch <= std::chrono::steady_clock::duration::zero()) {
+    return;
+  }
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(since_epoch);
+  timespec ts;
+  ts.tv_sec = static_cast<decltype(ts.tv_sec)>(seconds.count());
+  ts.tv_nsec = static_cast<decltype(ts.tv_nsec)>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch - seconds).count());
+  // With TIMER_ABSTIME, retrying after a signal does not extend the sleep.
+  while (EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr)) {
+  }
+#else
+  std::this_thread::sleep_until(deadline);
+#endif
+}
+
+constexpr std::uint64_t kPowersOf10[] = {
+  1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u,
+  10000000000u, 100000000000u, 1000000000000u, 10000000000000u, 100000000000000u,
+  1000000000000000u, 10000000000000000u, 100000000000000000u};
+
+// Digits of the largest std::uint64_t.
+constexpr std::size_t kMaxUint64Digits = 20;
+
+// Scratch space for format_duration(). Each number is written with std::to_chars into a window
+// of kMaxUint64Digits characters, so the compiler can see that a sign, the hours, minutes and
+// seconds followed by their units or the decimal point, 9 fractional digits and a final unit
+// stay in bounds, even though the text never exceeds max_duration_length characters.
+constexpr std::size_t kFormatScratchSize = 1u + 3u * (kMaxUint64Digits + 1u) + 9u + 1u;
+
+// Fractional digits kept while parsing, so that fraction * mantissa fits in 64 bits.
+constexpr std::size_t kMaxFractionDigits = 17;
+
+struct duration_unit
+{
+  std::string_view suffix;
+  // The unit is mantissa * 10^exponent nanoseconds.
+  std::uint64_t mantissa;
+  std::size_t exponent;
+};
+
+// Suffixes sharing a prefix are listed longest first.
+constexpr duration_unit kDurationUnits[] = {
+  {"ns", 1u, 0u},
+  {"us", 1u, 3u},
+  {"\xc2\xb5s", 1u, 3u},  // U+00B5 MICRO SIGN
+  {"\xce\xbcs", 1u, 3u},  // U+03BC GREEK SMALL LETTER MU
+  {"ms", 1u, 6u},
+  {"s", 1u, 9u},
+  {"m", 6u, 10u},
+  {"h", 36u, 11u},
+};
+
+bool
+is_digit(char c) noexcept
+{
+  return c >= '0' && c <= '9';
+}
+
+const duration_unit *
+match_unit(std::string_view text) noexcept
+{
+  for (const duration_unit & unit : kDurationUnits) {
+    if (text.substr(0, unit.suffix.size()) == unit.suffix) {
+      return &unit;
+    }
+  }
+  return nullptr;
+}
+
+// Parse one number and unit at the start of text, adding its magnitude in nanoseconds to total.
+std::errc
+parse_duration_component(std::string_view & text, std::uint64_t & total) noexcept
+{
+  const char * p = text.data();
+  const char * const end = p + text.size();
+
+  std::uint64_t whole = 0;
+  const char * const whole_begin = p;
+  if (p != end && is_digit(*p)) {
+    const std::from_chars_result result = std::from_chars(p, end, whole);
+    if (std::errc() != result.ec) {
+      return result.ec;
+    }
+    p = result.ptr;
+  }
+  const bool has_whole = p != whole_begin;
+
+  std::uint64_t fraction = 0;
+  std::size_t fraction_digits = 0;
+  bool has_fraction = false;
+  if (p != end && '.' == *p) {
+    const char * const fraction_begin = ++p;
+    while (p != end && is_digit(*p)) {
+      ++p;
+    }
+    has_fraction = p != fraction_begin;
+    fraction_digits = std::min(static_cast<std::size_t>(p - fraction_begin), kMaxFractionDigits);
+    std::from_chars(fraction_begin, fraction_begin + fraction_digits, fraction);
+  }
+  if (!has_whole && !has_fraction) {
+    return std::errc::invalid_argument;
+  }
+
+  const duration_unit * unit = match_unit(std::string_view(p, static_cast<std::size_t>(end - p)));
+  if (nullptr == unit) {
+    return std::errc::invalid_argument;
+  }
+  p += unit->suffix.size();
+
+  // fraction < 10^fraction_digits, so neither product below can overflow.
+  const std::uint64_t fraction_nanoseconds = fraction_digits <= unit->exponent ?
+    fraction * unit->mantissa * kPowersOf10[unit->exponent - fraction_digits] :
+    fraction * unit->mantissa / kPowersOf10[fraction_digits - unit->exponent];
+  std::uint64_t value = 0;
+  if (
+    detail::multiply_overflow(whole, unit->mantissa * kPowersOf10[unit->exponent], value) ||
+    detail::add_overflow(value, fraction_nanoseconds, value) ||
+    detail::add_overflow(total, value, total))
+  {
+    return std::errc::result_out_of_range;
+  }
+  text.remove_prefix(static_cast<std::size_t>(p - text.data()));
+  return std::errc();
+}
+
+// Write value / 10^decimals with the fraction's trailing zeros removed.
+char *
+write_decimal(char * out, std::uint64_t value, std::size_t decimals) noexcept
+{
+  const std::uint64_t scale = kPowersOf10[decimals];
+  out = std::to_chars(out, out + kMaxUint64Digits, value / scale).ptr;
+  std::uint64_t fraction = value % scale;
+  if (0u != fraction) {
+    while (0u == fraction % 10u) {
+      fraction /= 10u;
+      --decimals;
+    }
+    *out++ = '.';
+    char * const fraction_end = out + decimals;
+    for (char * digit = fraction_end; digit != out; fraction /= 10u) {
+      *--digit = static_cast<char>('0' + fraction % 10u);
+    }
+    out = fraction_end;
+  }
+  return out;
+}
+
+}  // namespace
+
+tl::expected<std::chrono::nanoseconds, std::errc>
+parse_duration(std::string_view text) noexcept
+{
+  bool negative = false;
+  if (!text.empty() && ('-' == text.front() || '+' == text.front())) {
+    negative = '-' == text.front();
+    text.remove_prefix(1);
+  }
+  if ("0" == text) {
+    return std::chrono::nanoseconds(0);
+  }
+  if (text.empty()) {
+    return tl::make_unexpected(std::errc::invalid_argument);
+  }
+  std::uint64_t total = 0;
+  while (!text.empty()) {
+    const std::errc error = parse_duration_component(text, total);
+    if (std::errc() != error) {
+      return tl::make_unexpected(error);
+    }
+  }
+
+  constexpr auto max = static_cast<std::uint64_t>(std::chrono::nanoseconds::max().count());
+  if (total > max + (negative ? 1u : 0u)) {
+    return tl::make_unexpected(std::errc::result_out_of_range);
+  }
+  if (negative) {
+    // Negate in unsigned arithmetic, so that the magnitude of nanoseconds::min() is handled.
+    return std::chrono::nanoseconds(static_cast<std::int64_t>(0u - total));
+  }
+  return std::chrono::nanoseconds(static_cast<std::int64_t>(total));
+}
+
+std::to_chars_result
+format_duration(char * first, char * last, std::chrono::nanoseconds time) noexcept
+{
+  char buffer[kFormatScratchSize];
+  char * out = buffer;
+  std::uint64_t magnitude = static_cast<std::uint64_t>(time.count());
+  if (time.count() < 0) {
+    *out++ = '-';
+    magnitude = 0u - magnitude;
+  }
+
+  constexpr std::uint64_t second = 1000000000u;
+  if (0u == magnitude) {
+    *out++ = '0';
+    *out++ = 's';
+  } else if (magnitude < 1000u) {
+    out = std::to_chars(out, out + kMaxUint64Digits, magnitude).ptr;
+    *out++ = 'n';
+    *out++ = 's';
+  } else if (magnitude < second) {
+    const bool micro = magnitude < 1000000u;
+    out = write_decimal(out, magnitude, micro ? 3u : 6u);
+    *out++ = micro ? 'u' : 'm';
+    *out++ = 's';
+  } else {
+    const std::uint64_t hours = magnitude / (3600u * second);
+    const std::uint64_t minutes = magnitude / (60u * second) % 60u;
+    if (0u != hours) {
+      out = std::to_chars(out, out + kMaxUint64Digits, hours).ptr;
+      *out++ = 'h';
+    }
+    if (0u != hours || 0u != minutes) {
+      out = std::to_chars(out, out + kMaxUint64Digits, minutes).ptr;
+      *out++ = 'm';
+    }
+    out = write_decimal(out, magnitude % (60u * second), 9u);
+    *out++ = 's';
+  }
+
+  const auto length = static_cast<std::size_t>(out - buffer);
+  if (static_cast<std::size_t>(last - first) < length) {
+    return {last, std::errc::value_too_large};
+  }
+  std::memcpy(first, buffer, length);
+  return {first + length, std::errc()};
+}
+
+std::string
+format_duration(std::chrono::nanoseconds time)
+{
+  char buffer[max_duration_length];
+  const std::to_chars_result result = format_duration(buffer, buffer + max_duration_length, time);
+  return std::string(buffer, result.ptr);
+}
+
+void
+precise_sleep_until(
+  std::chrono::steady_clock::time_point deadline,
+  std::chrono::nanoseconds spin_margin)
+{
+  auto now = std::chrono::steady_clock::now();
+  if (deadline - now > spin_margin) {
+    sleep_until(deadline - spin_margin);
+    now = std::chrono::steady_clock::now();
+  }
+  while (now < deadline) {
+    spin_pause();
+    now = std::chrono::steady_clock::now();
+  }
+}
+
+rate_loop::rate_loop(std::chrono::nanoseconds period, std::chrono::nanoseconds spin_margin)
+: period_(period), spin_margin_(spin_margin)
+{
+  if (period <= std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("rate_loop period must be positive");
+  }
+  if (spin_margin < std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("rate_loop spin margin must not be negative");
+  }
+  reset();
+}
+
+bool
+rate_loop::sleep()
+{
+  ++statistics_.cycles;
+  const auto now = std::chrono::steady_clock::now();
+  if (now >= next_deadline_) {
+    // Skip the deadlines which passed entirely, keeping the phase of the schedule.
+    const std::chrono::nanoseconds overrun = now - next_deadline_;
+    const auto missed = overrun / period_;
+    ++statistics_.overruns;
+    statistics_.missed_cycles += static_cast<std::uint64_t>(missed);
+    statistics_.max_overrun = std::max(statistics_.max_overrun, overrun);
+    next_deadline_ += period_ * (missed + 1);
+    return false;
+  }
+
+  precise_sleep_until(next_deadline_, spin_margin_);
+  const std::chrono::nanoseconds jitter = std::chrono::steady_clock::now() - next_deadline_;
+  statistics_.min_jitter = std::min(statistics_.min_jitter, jitter);
+  statistics_.max_jitter = std::max(statistics_.max_jitter, jitter);
+  const auto samples = static_cast<double>(statistics_.cycles - statistics_.overruns);
+  const auto value = static_cast<double>(jitter.count());
+  const double delta = value - jitter_mean_;
+  jitter_mean_ += delta / samples;
+  jitter_m2_ += delta * (value - jitter_mean_);
+  next_deadline_ += period_;
+  return true;
+}
+
+void
+rate_loop::reset()
+{
+  next_deadline_ = std::chrono::steady_clock::now() + period_;
+}
+
+rate_loop_statistics
+rate_loop::statistics() const noexcept
+{
+  rate_loop_statistics result = statistics_;
+  const std::uint64_t samples = statistics_.cycles - statistics_.overruns;
+  if (0u != samples) {
+    result.mean_jitter = std::chrono::nanoseconds(std::llround(jitter_mean_));
+    result.jitter_stddev = std::chrono::nanoseconds(
+      std::llround(std::sqrt(jitter_m2_ / static_cast<double>(samples))));
+  }
+  return result;
+}
+
+void
+rate_loop::reset_statistics() noexcept
+{
+  statistics_ = rate_loop_statistics();
+  jitter_mean_ = 0.0;
+  jitter_m2_ = 0.0;
+}
+
+}  // namespace rcpputils
@@ -0,0 +1,216 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+# define RCPPUTILS_TSC_CLOCK_X86 1
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+#  include <x86intrin.h>
+# endif
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+# define RCPPUTILS_TSC_CLOCK_AARCH64 1
+#endif
+
+#include "rcpputils/tsc_clock.hpp"
+
+namespace rcpputils
+{
+namespace
+{
+
+// Nanoseconds per tick are kept as a fixed point number with this many fractional bits.
+constexpr unsigned kShift = 32;
+
+struct calibration
+{
+  bool counter_based;
+  std::uint64_t counter_base;
+  std::int64_t nanoseconds_base;
+  // Nanoseconds per tick, shifted left by kShift.
+  std::uint64_t multiplier;
+  double frequency;
+};
+
+std::int64_t
+steady_nanoseconds() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if defined(RCPPUTILS_TSC_CLOCK_X86)
+std::uint64_t
+read_counter() noexcept
+{
+  return __rdtsc();
+}
+
+// Without an invariant TSC the counter rate changes with the CPU frequency, and the counters of
+// different cores may drift apart.
+bool
+counter_is_invariant() noexcept
+{
+# if defined(_MSC_VER)
+  int registers[4];
+  __cpuid(registers, 0x80000000);
+  if (static_cast<unsigned>(registers[0]) < 0x80000007u) {
+    return false;
+  }
+  __cpuid(registers, 0x80000007);
+  return 0 != (registers[3] & (1 << 8));
+# else
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) {
+    return false;
+  }
+  __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+  return 0 != (edx & (1u << 8));
+# endif
+}
+#elif defined(RCPPUTILS_TSC_CLOCK_AARCH64)
+std::uint64_t
+read_counter() noexcept
+{
+  std::uint64_t ticks;
+  asm volatile ("mrs %0, cntvct_el0" : "=r" (ticks));
+  return ticks;
+}
+#endif
+
+#if defined(RCPPUTILS_TSC_CLOCK_X86) || defined(RCPPUTILS_TSC_CLOCK_AARCH64)
+// Compute ticks * multiplier >> kShift without overflowing.
+std::uint64_t
+scale(std::uint64_t ticks, std::uint64_t multiplier) noexcept
+{
+# if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  return static_cast<std::uint64_t>((static_cast<uint128>(ticks) * multiplier) >> kShift);
+# elif defined(_MSC_VER) && defined(_M_X64)
+  std::uint64_t high;
+  const std::uint64_t low = _umul128(ticks, multiplier, &high);
+  return __shiftright128(low, high, kShift);
+# else
+  const std::uint64_t ticks_high = ticks >> 32;
+  const std::uint64_t ticks_low = ticks & 0xffffffffu;
+  return ticks_high * multiplier + ((ticks_low * multiplier) >> kShift);
+# endif
+}
+
+// Read the counter and steady_clock as close together as possible, returning the counter value
+// at the midpoint of the steady_clock call.
+void
+sample(std::uint64_t & counter, std::int64_t & nanoseconds) noexcept
+{
+  std::uint64_t best_spread = UINT64_MAX;
+  for (int i = 0; i < 8; ++i) {
+    const std::uint64_t before = read_counter();
+    const std::int64_t now = steady_nanoseconds();
+    const std::uint64_t after = read_counter();
+    if (after - before < best_spread) {
+      best_spread = after - before;
+      counter = before + (after - before) / 2;
+      nanoseconds = now;
+    }
+  }
+}
+#endif
+
+calibration
+calibrate() noexcept
+{
+  calibration result{false, 0, 0, 0, 0.0};
+#if defined(RCPPUTILS_TSC_CLOCK_X86)
+  if (!counter_is_invariant()) {
+    return result;
+  }
+  std::uint64_t start_counter = 0;
+  std::int64_t start_nanoseconds = 0;
+  sample(start_counter, start_nanoseconds);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  sample(result.counter_base, result.nanoseconds_base);
+  const std::uint64_t ticks = result.counter_base - start_counter;
+  const auto elapsed = static_cast<std::uint64_t>(result.nanoseconds_base - start_nanoseconds);
+  if (0u == ticks || 0u == elapsed) {
+    return result;
+  }
+  result.multiplier = (elapsed << kShift) / ticks;
+  result.frequency = static_cast<double>(ticks) * 1e9 / static_cast<double>(elapsed);
+#elif defined(RCPPUTILS_TSC_CLOCK_AARCH64)
+  // The generic timer runs at a fixed rate which the system reports, so no measurement is needed.
+  std::uint64_t frequency;
+  asm volatile ("mrs %0, cntfrq_el0" : "=r" (frequency));
+  if (0u == frequency) {
+    return result;
+  }
+  sample(result.counter_base, result.nanoseconds_base);
+  result.multiplier = (std::uint64_t{1000000000} << kShift) / frequency;
+  result.frequency = static_cast<double>(frequency);
+#endif
+  result.counter_based = 0u != result.multiplier;
+  return result;
+}
+
+const calibration &
+get_calibration() noexcept
+{
+  static const calibration instance = calibrate();
+  return instance;
+}
+
+}  // namespace
+
+tsc_clock::time_point
+tsc_clock::now() noexcept
+{
+  const calibration & c = get_calibration();
+#if defined(RCPPUTILS_TSC_CLOCK_X86) || defined(RCPPUTILS_TSC_CLOCK_AARCH64)
+  if (c.counter_based) {
+    // Another core's counter may be marginally behind the one calibration ran on, or the one this
+    // thread last read on, so never return less than the last time returned to this thread.
+    thread_local std::int64_t last_returned = INT64_MIN;
+    const std::uint64_t counter = read_counter();
+    const std::int64_t offset = counter >= c.counter_base ?
+      static_cast<std::int64_t>(scale(counter - c.counter_base, c.multiplier)) :
+      -static_cast<std::int64_t>(scale(c.counter_base - counter, c.multiplier));
+    const std::int64_t nanoseconds = c.nanoseconds_base + offset;
+    if (nanoseconds > last_returned) {
+      last_returned = nanoseconds;
+    }
+    return time_point(duration(last_returned));
+  }
+#else
+  static_cast<void>(c);
+#endif
+  return time_point(duration(steady_nanoseconds()));
+}
+
+bool
+tsc_clock::is_counter_based() noexcept
+{
+  return get_calibration().counter_based;
+}
+
+double
+tsc_clock::counter_frequency() noexcept
+{
+  return get_calibration().frequency;
+}
+
+}  // namespace rcpputils
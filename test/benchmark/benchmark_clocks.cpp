@@ -0,0 +1,57 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcpputils/coarse_clock.hpp"
+#include "rcpputils/tsc_clock.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+BENCHMARK_F(PerformanceTest, steady_clock_now)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+  }
+}
+
+BENCHMARK_F(PerformanceTest, tsc_clock_now)(benchmark::State & st)
+{
+  // Calibrate outside of the measurement.
+  rcpputils::tsc_clock::is_counter_based();
+  reset_heap_counters();
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(rcpputils::tsc_clock::now());
+  }
+}
+
+BENCHMARK_F(PerformanceTest, coarse_clock_now)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(rcpputils::coarse_clock::now());
+  }
+}
+
+BENCHMARK_F(PerformanceTest, cached_clock_now)(benchmark::State & st)
+{
+  rcpputils::cached_clock::ticker ticker;
+  reset_heap_counters();
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(rcpputils::cached_clock::now());
+  }
+}
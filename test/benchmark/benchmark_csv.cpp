@@ -0,0 +1,74 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcpputils/csv.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+// 16 MiB of calibration style records of five fields, averaging 8 bytes each, one of them quoted.
+const std::string & csv_input()
+{
+  static const std::string input = [] {
+      std::mt19937 rng(42);
+      std::string ret;
+      while (ret.size() < 16 * 1024 * 1024) {
+        ret += std::to_string(rng() % 100000) + ",";
+        ret += std::to_string(rng() * 1e-6) + ",";
+        ret += "\"name, " + std::to_string(rng() % 1000) + "\",";
+        ret += "sensor_" + std::to_string(rng() % 16) + ",";
+        ret += std::to_string(rng() % 2) + "\n";
+      }
+      return ret;
+    }();
+  return input;
+}
+}  // namespace
+
+BENCHMARK_F(PerformanceTest, csv_reader_views)(benchmark::State & st)
+{
+  const std::string & input = csv_input();
+  std::vector<rcpputils::csv_field> fields;
+  fields.reserve(16);
+  reset_heap_counters();
+  for (auto _ : st) {
+    rcpputils::csv_reader reader(input);
+    while (reader.next_record(fields)) {
+      benchmark::DoNotOptimize(fields.data());
+    }
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * input.size()));
+}
+
+BENCHMARK_F(PerformanceTest, csv_reader_copies)(benchmark::State & st)
+{
+  const std::string & input = csv_input();
+  std::vector<std::string> fields;
+  reset_heap_counters();
+  for (auto _ : st) {
+    rcpputils::csv_reader reader(input);
+    while (reader.next_record(fields)) {
+      benchmark::DoNotOptimize(fields.data());
+    }
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * input.size()));
+}
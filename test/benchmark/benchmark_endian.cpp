@@ -0,0 +1,72 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcpputils/endian.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+// 1 MiB of 32-bit elements, as in a point cloud.
+constexpr std::size_t element_count = 256 * 1024;
+}  // namespace
+
+BENCHMARK_F(PerformanceTest, byteswap_loop_u32)(benchmark::State & st)
+{
+  std::vector<std::uint32_t> data(element_count);
+  std::iota(data.begin(), data.end(), 0u);
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (std::uint32_t & value : data) {
+      value = rcpputils::byteswap(value);
+    }
+    benchmark::DoNotOptimize(data.data());
+    benchmark::ClobberMemory();
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * element_count * 4));
+}
+
+BENCHMARK_F(PerformanceTest, byteswap_n_u32)(benchmark::State & st)
+{
+  std::vector<std::uint32_t> data(element_count);
+  std::iota(data.begin(), data.end(), 0u);
+  reset_heap_counters();
+  for (auto _ : st) {
+    rcpputils::byteswap_n(data);
+    benchmark::DoNotOptimize(data.data());
+    benchmark::ClobberMemory();
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * element_count * 4));
+}
+
+BENCHMARK_F(PerformanceTest, convert_endian_u16)(benchmark::State & st)
+{
+  std::vector<std::uint16_t> input(element_count * 2);
+  std::iota(input.begin(), input.end(), static_cast<std::uint16_t>(0));
+  std::vector<std::uint16_t> output(input.size());
+  reset_heap_counters();
+  for (auto _ : st) {
+    rcpputils::convert_endian(
+      input.data(), output.data(), input.size(), rcpputils::endian::big);
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * input.size() * 2));
+}
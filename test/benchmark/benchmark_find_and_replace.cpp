@@ -0,0 +1,89 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcpputils/find_and_replace.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+// 1 MiB of input in which every fourth byte starts a match.
+const std::string & dense_input()
+{
+  static const std::string input = [] {
+      std::string ret;
+      while (ret.size() < 1024 * 1024) {
+        ret += "{x}_";
+      }
+      return ret;
+    }();
+  return input;
+}
+}  // namespace
+
+BENCHMARK_F(PerformanceTest, find_and_replace_dense_grow)(benchmark::State & st)
+{
+  const std::string & input = dense_input();
+  const std::string find = "{x}";
+  const std::string replace = "value";
+  reset_heap_counters();
+  for (auto _ : st) {
+    std::string ret = rcpputils::find_and_replace(input, find, replace);
+    benchmark::DoNotOptimize(ret);
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * input.size()));
+}
+
+BENCHMARK_F(PerformanceTest, find_and_replace_dense_shrink)(benchmark::State & st)
+{
+  const std::string & input = dense_input();
+  const std::string find = "{x}";
+  const std::string replace = "v";
+  reset_heap_counters();
+  for (auto _ : st) {
+    std::string ret = rcpputils::find_and_replace(input, find, replace);
+    benchmark::DoNotOptimize(ret);
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * input.size()));
+}
+
+BENCHMARK_F(PerformanceTest, find_and_replace_dense_same_length)(benchmark::State & st)
+{
+  const std::string & input = dense_input();
+  const std::string find = "{x}";
+  const std::string replace = "<y>";
+  reset_heap_counters();
+  for (auto _ : st) {
+    std::string ret = rcpputils::find_and_replace(input, find, replace);
+    benchmark::DoNotOptimize(ret);
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * input.size()));
+}
+
+BENCHMARK_F(PerformanceTest, find_and_replace_dense_single_char)(benchmark::State & st)
+{
+  const std::string & input = dense_input();
+  const std::string find = "_";
+  const std::string replace = "/";
+  reset_heap_counters();
+  for (auto _ : st) {
+    std::string ret = rcpputils::find_and_replace(input, find, replace);
+    benchmark::DoNotOptimize(ret);
+  }
+  st.SetBytesProcessed(static_cast<int64_t>(st.iterations() * input.size()));
+}
@@ -0,0 +1,138 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "rcpputils/coarse_clock.hpp"
+
+using rcpputils::cached_clock;
+using rcpputils::coarse_clock;
+using namespace std::chrono_literals;
+
+static_assert(coarse_clock::is_steady, "coarse_clock must be steady");
+static_assert(cached_clock::is_steady, "cached_clock must be steady");
+
+TEST(test_coarse_clock, resolution) {
+  EXPECT_GT(coarse_clock::resolution(), 0ns);
+  EXPECT_LE(coarse_clock::resolution(), 100ms);
+}
+
+TEST(test_coarse_clock, tracks_steady_clock) {
+  coarse_clock::time_point previous = coarse_clock::now();
+  for (int i = 0; i < 10000; ++i) {
+    const coarse_clock::time_point now = coarse_clock::now();
+    ASSERT_LE(previous, now);
+    previous = now;
+  }
+
+  // The clocks share an epoch. The coarse clock lags by about its resolution, but by more on
+  // tickless kernels when the tick was deferred, so only check it is in the same ballpark.
+  const auto steady = std::chrono::steady_clock::now().time_since_epoch();
+  const auto coarse = coarse_clock::now().time_since_epoch();
+  EXPECT_LE(coarse, steady + 1ms);
+  EXPECT_GE(coarse, steady - coarse_clock::resolution() - 100ms);
+}
+
+TEST(test_cached_clock, falls_back_without_ticker) {
+  ASSERT_FALSE(cached_clock::is_running());
+  EXPECT_EQ(0ns, cached_clock::max_staleness());
+  const auto before = std::chrono::steady_clock::now().time_since_epoch();
+  const auto cached = cached_clock::now().time_since_epoch();
+  const auto after = std::chrono::steady_clock::now().time_since_epoch();
+  EXPECT_LE(before, cached);
+  EXPECT_LE(cached, after);
+}
+
+TEST(test_cached_clock, ticker) {
+  EXPECT_THROW(cached_clock::ticker(0ns), std::invalid_argument);
+  EXPECT_FALSE(cached_clock::is_running());
+
+  {
+    cached_clock::ticker ticker(2ms);
+    EXPECT_TRUE(cached_clock::is_running());
+    EXPECT_EQ(2ms, cached_clock::resolution());
+    EXPECT_EQ(2ms, cached_clock::max_staleness());
+    EXPECT_THROW(cached_clock::ticker(1ms), std::logic_error);
+    EXPECT_TRUE(cached_clock::is_running());
+
+    const auto start = cached_clock::now();
+    EXPECT_LE(start.time_since_epoch(), std::chrono::steady_clock::now().time_since_epoch());
+    // The published time advances while the ticker runs.
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (cached_clock::now() == start && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_GT(cached_clock::now(), start);
+
+    cached_clock::time_point previous = cached_clock::now();
+    for (int i = 0; i < 10000; ++i) {
+      const cached_clock::time_point now = cached_clock::now();
+      ASSERT_LE(previous, now);
+      previous = now;
+    }
+  }
+
+  EXPECT_FALSE(cached_clock::is_running());
+  EXPECT_EQ(0ns, cached_clock::max_staleness());
+
+  // A new ticker may be started once the previous one is gone.
+  cached_clock::ticker ticker;
+  EXPECT_EQ(1ms, cached_clock::max_staleness());
+}
+
+TEST(test_cached_clock, monotonic_across_ticker_start_and_stop) {
+  ASSERT_FALSE(cached_clock::is_running());
+  // Readers racing with the ticker starting may read the time directly just before the first,
+  // older, published time becomes visible.
+  std::atomic<bool> done{false};
+  std::atomic<int> backwards{0};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back(
+      [&done, &backwards] {
+        cached_clock::time_point previous = cached_clock::now();
+        while (!done) {
+          const cached_clock::time_point now = cached_clock::now();
+          if (now < previous) {
+            ++backwards;
+          }
+          previous = now;
+        }
+      });
+  }
+
+  cached_clock::time_point previous = cached_clock::now();
+  for (int i = 0; i < 1000; ++i) {
+    {
+      cached_clock::ticker ticker(10ms);
+      const cached_clock::time_point now = cached_clock::now();
+      EXPECT_LE(previous, now);
+      previous = now;
+    }
+    const cached_clock::time_point now = cached_clock::now();
+    EXPECT_LE(previous, now);
+    previous = now;
+  }
+  done = true;
+  for (std::thread & reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(0, backwards);
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rcpputils/csv.hpp"
+
+namespace
+{
+std::vector<std::vector<std::string>>
+read_all(std::string_view input, char delimiter = ',')
+{
+  rcpputils::csv_reader reader(input, delimiter);
+  std::vector<std::vector<std::string>> records;
+  std::vector<std::string> fields;
+  while (reader.next_record(fields)) {
+    records.push_back(fields);
+  }
+  return records;
+}
+
+using records_t = std::vector<std::vector<std::string>>;
+}  // namespace
+
+TEST(test_csv, simple)
+{
+  EXPECT_EQ(records_t(), read_all(""));
+  EXPECT_EQ(records_t({{"a", "b", "c"}}), read_all("a,b,c"));
+  EXPECT_EQ(records_t({{"a", "b"}, {"c", "d"}}), read_all("a,b\nc,d\n"));
+  EXPECT_EQ(records_t({{"a", "b"}, {"c", "d"}}), read_all("a,b\r\nc,d\r\n"));
+  EXPECT_EQ(records_t({{"a", ""}, {"", "d"}}), read_all("a,\n,d"));
+  EXPECT_EQ(records_t({{"a"}, {"b"}}), read_all("a\n\n\r\nb\n"));
+  EXPECT_EQ(records_t({{"a", "b"}}), read_all("a;b", ';'));
+}
+
+TEST(test_csv, quoted)
+{
+  EXPECT_EQ(records_t({{"a,b", "c"}}), read_all("\"a,b\",c"));
+  EXPECT_EQ(records_t({{"line\nbreak", "x"}}), read_all("\"line\nbreak\",x\n"));
+  EXPECT_EQ(records_t({{"say \"hi\"", ""}}), read_all("\"say \"\"hi\"\"\",\"\"\n"));
+  EXPECT_EQ(records_t({{"\"", "a"}}), read_all("\"\"\"\",a"));
+  EXPECT_EQ(records_t({{"a"}, {""}}), read_all("\"a\"\r\n\"\"\r\n"));
+}
+
+TEST(test_csv, view_mode)
+{
+  const std::string input = "id,\"name, full\",\"q\"\"uote\"\n";
+  rcpputils::csv_reader reader(input);
+  std::vector<rcpputils::csv_field> fields;
+  ASSERT_TRUE(reader.next_record(fields));
+  ASSERT_EQ(3u, fields.size());
+  EXPECT_EQ("id", fields[0].value);
+  EXPECT_FALSE(fields[0].quoted);
+  EXPECT_EQ("name, full", fields[1].value);
+  EXPECT_TRUE(fields[1].quoted);
+  EXPECT_FALSE(fields[1].escaped);
+  EXPECT_EQ(input.data() + 4, fields[1].value.data());
+  EXPECT_EQ("q\"\"uote", fields[2].value);
+  EXPECT_TRUE(fields[2].escaped);
+  EXPECT_EQ("q\"uote", fields[2].unescaped());
+  EXPECT_FALSE(reader.next_record(fields));
+  EXPECT_TRUE(fields.empty());
+}
+
+TEST(test_csv, block_boundaries)
+{
+  // Quoted fields, delimiters and line breaks straddling the 64 byte classification blocks.
+  records_t expected;
+  std::string input;
+  for (std::size_t i = 0; i < 300; ++i) {
+    const std::string plain(i % 70, 'x');
+    const std::string quoted = std::string(i % 13, 'q') + ",\n\"" + std::string(i % 5, 'z');
+    expected.push_back({plain, quoted, std::to_string(i)});
+    std::string escaped;
+    for (const char c : quoted) {
+      escaped += c;
+      if ('"' == c) {
+        escaped += c;
+      }
+    }
+    input += plain + ",\"" + escaped + "\"," + std::to_string(i) + (i % 2 ? "\n" : "\r\n");
+  }
+  EXPECT_EQ(expected, read_all(input));
+}
+
+TEST(test_csv, invalid_arguments)
+{
+  EXPECT_THROW(rcpputils::csv_reader("", ',', ','), std::invalid_argument);
+  EXPECT_THROW(rcpputils::csv_reader("", '\n'), std::invalid_argument);
+}
@@ -14,6 +14,13 @@
 
 #include "gtest/gtest.h"
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
 #include "rcpputils/endian.hpp"
 
 // Basic runtime endianness check
@@ -54,3 +61,170 @@ TEST(test_endian, runtime_endianness)
     std::cout << "Runtime reports: big endian" << std::endl;
   }
 }
+
+static_assert(rcpputils::byteswap(std::uint8_t{0x12}) == 0x12, "byteswap is constexpr");
+static_assert(rcpputils::byteswap(std::uint16_t{0x1234}) == 0x3412, "byteswap is constexpr");
+static_assert(
+  rcpputils::byteswap(std::uint32_t{0x12345678}) == 0x78563412u, "byteswap is constexpr");
+static_assert(
+  rcpputils::byteswap(std::uint64_t{0x0123456789abcdefu}) == 0xefcdab8967452301u,
+  "byteswap is constexpr");
+static_assert(rcpputils::byteswap(std::int16_t{-2}) == -257, "byteswap swaps signed values");
+static_assert(
+  rcpputils::from_big(rcpputils::to_big(std::int32_t{-123456})) == -123456,
+  "from_big reverses to_big");
+static_assert(
+  rcpputils::from_little(rcpputils::to_little(std::uint64_t{42})) == 42u,
+  "from_little reverses to_little");
+
+namespace
+{
+enum class test_enum : std::int16_t
+{
+  value = 0x0102
+};
+
+// Get the bytes of a value as they are laid out in memory.
+template<typename T>
+std::array<std::uint8_t, sizeof(T)>
+bytes_of(T value)
+{
+  std::array<std::uint8_t, sizeof(T)> bytes;
+  std::memcpy(bytes.data(), &value, sizeof(T));
+  return bytes;
+}
+}  // namespace
+
+TEST(test_endian, byteswap)
+{
+  EXPECT_EQ(0x3412, rcpputils::byteswap(std::uint16_t{0x1234}));
+  EXPECT_EQ(static_cast<std::int32_t>(0x78563412), rcpputils::byteswap(std::int32_t{0x12345678}));
+  EXPECT_EQ(std::int64_t{-1}, rcpputils::byteswap(std::int64_t{-1}));
+  EXPECT_EQ('x', rcpputils::byteswap('x'));
+  EXPECT_TRUE(rcpputils::byteswap(true));
+  EXPECT_EQ(static_cast<test_enum>(0x0201), rcpputils::byteswap(test_enum::value));
+
+  const std::uint32_t value = 0x11223344;
+  const auto swapped = bytes_of(rcpputils::byteswap(value));
+  const auto original = bytes_of(value);
+  for (std::size_t i = 0; i < sizeof(value); ++i) {
+    EXPECT_EQ(original[i], swapped[sizeof(value) - 1 - i]);
+  }
+}
+
+TEST(test_endian, byteswap_floating_point)
+{
+  for (const double value : {0.0, -1.5, 3.141592653589793, std::numeric_limits<double>::max()}) {
+    const auto swapped = bytes_of(rcpputils::byteswap(value));
+    const auto original = bytes_of(value);
+    for (std::size_t i = 0; i < sizeof(value); ++i) {
+      EXPECT_EQ(original[i], swapped[sizeof(value) - 1 - i]);
+    }
+    EXPECT_EQ(value, rcpputils::byteswap(rcpputils::byteswap(value)));
+  }
+  const float value = 2.5f;
+  EXPECT_EQ(value, rcpputils::from_big(rcpputils::to_big(value)));
+  EXPECT_EQ(value, rcpputils::from_little(rcpputils::to_little(value)));
+}
+
+TEST(test_endian, byte_order_conversions)
+{
+  const std::uint32_t value = 0x0a0b0c0d;
+  const std::array<std::uint8_t, 4> big_endian = {0x0a, 0x0b, 0x0c, 0x0d};
+  const std::array<std::uint8_t, 4> little_endian = {0x0d, 0x0c, 0x0b, 0x0a};
+  EXPECT_EQ(big_endian, bytes_of(rcpputils::to_big(value)));
+  EXPECT_EQ(little_endian, bytes_of(rcpputils::to_little(value)));
+
+  std::uint32_t decoded;
+  std::memcpy(&decoded, big_endian.data(), sizeof(decoded));
+  EXPECT_EQ(value, rcpputils::from_big(decoded));
+  std::memcpy(&decoded, little_endian.data(), sizeof(decoded));
+  EXPECT_EQ(value, rcpputils::from_little(decoded));
+}
+
+namespace
+{
+// Check byteswap_n against byteswap for all lengths crossing the vector widths. Unaligned data
+// goes through the byte pointer entry point which byteswap_n forwards to, as a misaligned T * is
+// itself undefined behavior.
+template<typename T>
+void
+check_byteswap_n()
+{
+  constexpr std::size_t max_count = 80;
+  std::vector<unsigned char> storage((max_count + 1) * sizeof(T));
+  std::iota(storage.begin(), storage.end(), static_cast<unsigned char>(1));
+  for (std::size_t offset = 0; offset < sizeof(T); ++offset) {
+    for (std::size_t count = 0; count < max_count; ++count) {
+      std::vector<T> input(count);
+      std::vector<T> expected(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        std::memcpy(&input[i], storage.data() + offset + i * sizeof(T), sizeof(T));
+        expected[i] = rcpputils::byteswap(input[i]);
+      }
+
+      // Out of place, from and to unaligned addresses.
+      std::vector<unsigned char> output_storage((count + 1) * sizeof(T));
+      rcpputils::detail::byteswap_elements(
+        storage.data() + offset, output_storage.data() + offset, sizeof(T), count);
+      std::vector<T> output(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        std::memcpy(&output[i], output_storage.data() + offset + i * sizeof(T), sizeof(T));
+      }
+      ASSERT_EQ(expected, output) << count;
+
+      // Out of place and in place, through the typed overloads.
+      std::vector<T> typed_output(count);
+      rcpputils::byteswap_n(input.data(), typed_output.data(), count);
+      ASSERT_EQ(expected, typed_output) << count;
+      rcpputils::byteswap_n(input);
+      ASSERT_EQ(expected, input) << count;
+    }
+  }
+}
+}  // namespace
+
+TEST(test_endian, byteswap_n)
+{
+  check_byteswap_n<std::uint16_t>();
+  check_byteswap_n<std::int32_t>();
+  check_byteswap_n<std::uint64_t>();
+
+  std::array<std::uint8_t, 3> bytes = {1, 2, 3};
+  rcpputils::byteswap_n(bytes);
+  EXPECT_EQ((std::array<std::uint8_t, 3>{1, 2, 3}), bytes);
+
+  std::vector<double> doubles = {1.0, -2.5, 1e300};
+  rcpputils::byteswap_n(doubles.data(), doubles.size());
+  rcpputils::byteswap_n(doubles);
+  EXPECT_EQ((std::vector<double>{1.0, -2.5, 1e300}), doubles);
+}
+
+TEST(test_endian, convert_endian)
+{
+  const std::array<std::uint8_t, 8> big_endian = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+  std::array<std::uint16_t, 4> encoded;
+  std::memcpy(encoded.data(), big_endian.data(), sizeof(encoded));
+
+  std::array<std::uint16_t, 4> decoded;
+  rcpputils::convert_endian(
+    encoded.data(), decoded.data(), decoded.size(), rcpputils::endian::big);
+  EXPECT_EQ((std::array<std::uint16_t, 4>{0x0102, 0x0304, 0x0506, 0x0708}), decoded);
+
+  std::array<std::uint16_t, 4> little_endian;
+  rcpputils::convert_endian(
+    decoded.data(), little_endian.data(), decoded.size(), rcpputils::endian::native,
+    rcpputils::endian::little);
+  EXPECT_EQ(
+    (std::array<std::uint8_t, 8>{0x02, 0x01, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07}),
+    bytes_of(little_endian));
+
+  // Matching byte orders copy, or do nothing in place.
+  std::array<std::uint16_t, 4> copy{};
+  rcpputils::convert_endian(
+    decoded.data(), copy.data(), copy.size(), rcpputils::endian::big, rcpputils::endian::big);
+  EXPECT_EQ(decoded, copy);
+  rcpputils::convert_endian(
+    copy.data(), copy.data(), copy.size(), rcpputils::endian::little, rcpputils::endian::little);
+  EXPECT_EQ(decoded, copy);
+}
@@ -13,7 +13,14 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "rcpputils/find_and_replace.hpp"
 
@@ -67,6 +74,38 @@ TEST(test_find_and_replace, find_and_replace) {
     auto ret = rcpputils::find_and_replace("foobar", "foobar", "bar");
     EXPECT_EQ("bar", ret);
   }
+  // Single character find and replace
+  {
+    auto ret = rcpputils::find_and_replace("/my/ns/node", "/", "_");
+    EXPECT_EQ("_my_ns_node", ret);
+  }
+  // Equal length find and replace
+  {
+    auto ret = rcpputils::find_and_replace("foofoofo", "foo", "bar");
+    EXPECT_EQ("barbarfo", ret);
+  }
+  // Overlapping candidates are replaced left to right
+  {
+    auto ret = rcpputils::find_and_replace("aaaaa", "aa", "b");
+    EXPECT_EQ("bba", ret);
+  }
+  {
+    auto ret = rcpputils::find_and_replace("aaaaa", "aa", "ab");
+    EXPECT_EQ("ababa", ret);
+  }
+  // Growing and shrinking with many matches
+  {
+    std::string input;
+    std::string grown;
+    std::string shrunk;
+    for (int i = 0; i < 1000; ++i) {
+      input += "::x";
+      grown += "/-/x";
+      shrunk += "x";
+    }
+    EXPECT_EQ(grown, rcpputils::find_and_replace(input, "::", "/-/"));
+    EXPECT_EQ(shrunk, rcpputils::find_and_replace(input, "::", ""));
+  }
 }
 
 TEST(test_find_and_replace, find_and_replace_wstring) {
@@ -88,3 +127,139 @@ TEST(test_find_and_replace, find_and_replace_various_input_types) {
 
   rcpputils::find_and_replace("foo", "foo", std::string("bar"));
 }
+
+TEST(test_find_and_replace, multi_replacer) {
+  const rcpputils::multi_replacer replacer({
+      {"{ns}", "/robot"},
+      {"{node}", "driver"},
+      {"~", "/home/user"},
+      {"$(env X)", "x_value"},
+    });
+  EXPECT_EQ("", replacer.apply(""));
+  EXPECT_EQ("nothing to do", replacer.apply("nothing to do"));
+  EXPECT_EQ(
+    "/home/user/log/robot/driver_x_value.log",
+    replacer.apply("~/log{ns}/{node}_$(env X).log"));
+  EXPECT_EQ("/robot/robot{no", replacer.apply("{ns}{ns}{no"));
+
+  std::string output = "prefix:";
+  replacer.apply("{node}", output);
+  EXPECT_EQ("prefix:driver", output);
+}
+
+TEST(test_find_and_replace, multi_replacer_leftmost_longest) {
+  {
+    const rcpputils::multi_replacer replacer({{"a", "1"}, {"abc", "3"}, {"ab", "2"}});
+    EXPECT_EQ("3d", replacer.apply("abcd"));
+    EXPECT_EQ("2x1", replacer.apply("abxa"));
+  }
+  {
+    const rcpputils::multi_replacer replacer({{"bc", "X"}, {"abcd", "Y"}});
+    EXPECT_EQ("Y", replacer.apply("abcd"));
+    EXPECT_EQ("aXe", replacer.apply("abce"));
+  }
+  {
+    const rcpputils::multi_replacer replacer({{"ab", "X"}, {"bcd", "Y"}});
+    EXPECT_EQ("Xcd", replacer.apply("abcd"));
+  }
+  {
+    // Replacement text is not rescanned.
+    const rcpputils::multi_replacer replacer({{"a", "aa"}, {"aa", "b"}});
+    EXPECT_EQ("bb", replacer.apply("aaaa"));
+    EXPECT_EQ("baa", replacer.apply("aaa"));
+  }
+}
+
+TEST(test_find_and_replace, multi_replacer_matches_brute_force) {
+  const std::vector<std::pair<std::string, std::string>> pairs = {
+    {"ab", "<1>"}, {"aba", "<2>"}, {"b", "<3>"}, {"bab", "<4>"}, {"cc", ""}, {"abcab", "<5>"}};
+  const rcpputils::multi_replacer replacer(pairs);
+  const auto brute_force = [&pairs](const std::string & input) {
+      std::string output;
+      std::size_t i = 0;
+      while (i < input.size()) {
+        const std::pair<std::string, std::string> * best = nullptr;
+        for (const auto & pair : pairs) {
+          if (0 == input.compare(i, pair.first.size(), pair.first) &&
+            (!best || pair.first.size() > best->first.size()))
+          {
+            best = &pair;
+          }
+        }
+        if (best) {
+          output += best->second;
+          i += best->first.size();
+        } else {
+          output += input[i++];
+        }
+      }
+      return output;
+    };
+  std::uint32_t seed = 12345;
+  for (int n = 0; n < 500; ++n) {
+    std::string input;
+    for (int j = 0; j < n % 40; ++j) {
+      seed = seed * 1103515245u + 12345u;
+      input += "abcx"[(seed >> 16) % 4];
+    }
+    EXPECT_EQ(brute_force(input), replacer.apply(input)) << "input: " << input;
+  }
+}
+
+TEST(test_find_and_replace, multi_replacer_invalid) {
+  using pairs = std::vector<std::pair<std::string, std::string>>;
+  EXPECT_THROW(rcpputils::multi_replacer(pairs({{"", "x"}})), std::invalid_argument);
+  EXPECT_THROW(rcpputils::multi_replacer(pairs({{"a", "x"}, {"a", "y"}})), std::invalid_argument);
+  EXPECT_EQ("abc", rcpputils::multi_replacer(pairs()).apply("abc"));
+}
+
+TEST(test_find_and_replace, find_and_replace_in_place) {
+  const auto in_place = [](std::string input, const std::string & find, const std::string & replace)
+    {
+      const std::string expected = rcpputils::find_and_replace(input, find, replace);
+      const std::size_t count = rcpputils::find_and_replace_in_place(input, find, replace);
+      EXPECT_EQ(expected, input);
+      return std::make_pair(input, count);
+    };
+  using result = std::pair<std::string, std::size_t>;
+  EXPECT_EQ(result("", 0u), in_place("", "foo", "bar"));
+  EXPECT_EQ(result("foo", 0u), in_place("foo", "", "bar"));
+  EXPECT_EQ(result("foo", 0u), in_place("foo", "bar", "bazz"));
+  EXPECT_EQ(result("", 1u), in_place("foo", "foo", ""));
+  EXPECT_EQ(result("bazbarbazbar", 2u), in_place("foobarfoobar", "foo", "baz"));
+  EXPECT_EQ(result("_my_ns_node", 3u), in_place("/my/ns/node", "/", "_"));
+  EXPECT_EQ(result("a b c", 2u), in_place("a::b::c", "::", " "));
+  EXPECT_EQ(result("a::::b::::c", 2u), in_place("a::b::c", "::", "::::"));
+  EXPECT_EQ(result("barfoobar", 1u), in_place("foobar", "foo", "barfoo"));
+  EXPECT_EQ(result("xyzxyza", 2u), in_place("aaaaa", "aa", "xyz"));
+  EXPECT_EQ(result("{x}{x}{x}", 3u), in_place("xxx", "x", "{x}"));
+
+  std::string input = "/a/b";
+  input.reserve(64);
+  const auto * const data = input.data();
+  EXPECT_EQ(2u, rcpputils::find_and_replace_in_place(input, "/", "::"));
+  EXPECT_EQ("::a::b", input);
+  EXPECT_EQ(data, input.data());
+}
+
+TEST(test_find_and_replace, find_and_replace_to_output) {
+  std::string output = "prefix:";
+  rcpputils::find_and_replace(std::string_view("a/b/c"), "/", "::", output);
+  EXPECT_EQ("prefix:a::b::c", output);
+  rcpputils::find_and_replace(std::string_view("abc"), "", "::", output);
+  EXPECT_EQ("prefix:a::b::cabc", output);
+
+  std::vector<char> chars;
+  rcpputils::find_and_replace(
+    std::string_view("foobarfoo"), "foo", "x", std::back_inserter(chars));
+  EXPECT_EQ("xbarx", std::string(chars.begin(), chars.end()));
+
+  char buffer[16] = {};
+  char * const end = rcpputils::find_and_replace(
+    std::string_view("aaaaa"), "aa", "b", buffer);
+  EXPECT_EQ("bba", std::string(buffer, end));
+
+  std::wstring wide;
+  rcpputils::find_and_replace(std::wstring_view(L"a.b"), L".", L"->", wide);
+  EXPECT_EQ(L"a->b", wide);
+}
@@ -0,0 +1,202 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rcpputils/fixed_string.hpp"
+
+// Count heap allocations by replacing the global allocation functions.
+// Every replaceable form is replaced, so that each allocation is released by the matching
+// function, and they are kept out of line so that the compiler does not pair the malloc and free
+// calls inside them with the operator new and operator delete calls of their callers.
+#if defined(__GNUC__)
+# define RCPPUTILS_TEST_NOINLINE __attribute__((noinline))
+#else
+# define RCPPUTILS_TEST_NOINLINE
+#endif
+
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+
+void *
+counted_malloc(std::size_t size) noexcept
+{
+  ++allocations;
+  return std::malloc(0u == size ? 1u : size);
+}
+}  // namespace
+
+RCPPUTILS_TEST_NOINLINE void *
+operator new(std::size_t size)
+{
+  if (void * ptr = counted_malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+RCPPUTILS_TEST_NOINLINE void *
+operator new[](std::size_t size)
+{
+  if (void * ptr = counted_malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+RCPPUTILS_TEST_NOINLINE void *
+operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+  return counted_malloc(size);
+}
+
+RCPPUTILS_TEST_NOINLINE void *
+operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+  return counted_malloc(size);
+}
+
+RCPPUTILS_TEST_NOINLINE void
+operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+RCPPUTILS_TEST_NOINLINE void
+operator delete[](void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+RCPPUTILS_TEST_NOINLINE void
+operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+RCPPUTILS_TEST_NOINLINE void
+operator delete[](void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+RCPPUTILS_TEST_NOINLINE void
+operator delete(void * ptr, const std::nothrow_t &) noexcept
+{
+  std::free(ptr);
+}
+
+RCPPUTILS_TEST_NOINLINE void
+operator delete[](void * ptr, const std::nothrow_t &) noexcept
+{
+  std::free(ptr);
+}
+
+TEST(test_fixed_string, append) {
+  rcpputils::fixed_string<8> str;
+  EXPECT_TRUE(str.empty());
+  EXPECT_EQ(8u, str.capacity());
+  EXPECT_EQ(8u, str.available());
+  EXPECT_STREQ("", str.c_str());
+
+  EXPECT_TRUE(str.append("abc"));
+  EXPECT_TRUE(str.push_back('-'));
+  str += "de";
+  EXPECT_EQ("abc-de", str.view());
+  EXPECT_STREQ("abc-de", str.c_str());
+  EXPECT_EQ(2u, str.available());
+  EXPECT_FALSE(str.truncated());
+
+  EXPECT_FALSE(str.append("fgh"));
+  EXPECT_TRUE(str.truncated());
+  EXPECT_EQ("abc-defg", str.view());
+  EXPECT_STREQ("abc-defg", str.c_str());
+  // Once truncated, the string stays a prefix of the intended text.
+  EXPECT_FALSE(str.push_back('x'));
+  EXPECT_TRUE(str.append(""));
+  EXPECT_EQ("abc-defg", std::string_view(str));
+
+  str.clear();
+  EXPECT_TRUE(str.empty());
+  EXPECT_FALSE(str.truncated());
+  EXPECT_TRUE(str.append("xyz"));
+  EXPECT_EQ("xyz", str.view());
+}
+
+TEST(test_fixed_string, construct) {
+  constexpr rcpputils::fixed_string<4> fits("abcd");
+  static_assert(fits.size() == 4u, "constexpr construction");
+  static_assert(!fits.truncated(), "constexpr construction");
+  const rcpputils::fixed_string<4> truncated("abcde");
+  EXPECT_EQ("abcd", truncated.view());
+  EXPECT_TRUE(truncated.truncated());
+  const rcpputils::fixed_string<0> none("a");
+  EXPECT_EQ("", none.view());
+  EXPECT_TRUE(none.truncated());
+}
+
+TEST(test_fixed_string, append_number) {
+  rcpputils::fixed_string<32> str;
+  EXPECT_TRUE(str.append_number(-42));
+  str += ' ';
+  EXPECT_TRUE(str.append_number(0.25));
+  str += ' ';
+  EXPECT_TRUE(str.append_number(UINT64_MAX));
+  EXPECT_EQ("-42 0.25 18446744073709551615", str.view());
+
+  rcpputils::fixed_string<3> small;
+  EXPECT_FALSE(small.append_number(12345));
+  EXPECT_EQ("123", small.view());
+  EXPECT_TRUE(small.truncated());
+}
+
+TEST(test_fixed_string, join_append) {
+  const std::array<std::string_view, 3> parts{"robot", "arm", "joint_states"};
+  const std::array<int, 4> numbers{1, -2, 3, 40};
+  const std::vector<std::string> strings{"a", "b"};
+
+  rcpputils::fixed_string<64> topic;
+  rcpputils::fixed_string<16> small;
+  const std::size_t before = allocations;
+  EXPECT_TRUE(rcpputils::join_append(topic, parts, "/"));
+  topic += " [";
+  EXPECT_TRUE(rcpputils::join_append(topic, numbers, ", "));
+  topic += "] ";
+  EXPECT_TRUE(rcpputils::join_append(topic, strings.begin(), strings.end(), nullptr));
+  topic += ' ';
+  EXPECT_TRUE(
+    rcpputils::join_append(
+      topic, numbers, ";", [](auto & out, int n) {
+        out += '#';
+        out.append_number(n * 2);
+      }));
+  EXPECT_FALSE(rcpputils::join_append(small, parts, "/"));
+  const std::size_t after = allocations;
+
+  EXPECT_EQ(before, after);
+  EXPECT_EQ("robot/arm/joint_states [1, -2, 3, 40] ab #2;#-4;#6;#80", topic.view());
+  EXPECT_FALSE(topic.truncated());
+  EXPECT_EQ("robot/arm/joint_", small.view());
+  EXPECT_TRUE(small.truncated());
+}
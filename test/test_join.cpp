@@ -14,8 +14,17 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <list>
+#include <map>
+#include <set>
+#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "rcpputils/join.hpp"
@@ -92,3 +101,97 @@ TEST(test_join, join_ints_list) {
     EXPECT_EQ("1, 2, 3", rcpputils::join(many_elements, ", "));
   }
 }
+
+TEST(test_join, join_numbers_like_ostream) {
+  const std::vector<double> doubles{
+    0.0, -1.5, 0.1, 3.14159265358979, 1e10, 1e-7, 123456789.0,
+    std::numeric_limits<double>::infinity()};
+  std::ostringstream expected;
+  for (std::size_t i = 0; i < doubles.size(); ++i) {
+    expected << (i ? "," : "") << doubles[i];
+  }
+  EXPECT_EQ(expected.str(), rcpputils::join(doubles, ","));
+  EXPECT_EQ("0.5;-2", rcpputils::join(std::vector<float>{0.5f, -2.0f}, ";"));
+
+  const std::vector<int64_t> ints{
+    std::numeric_limits<int64_t>::min(), 0, std::numeric_limits<int64_t>::max()};
+  EXPECT_EQ(
+    "-9223372036854775808 0 9223372036854775807", rcpputils::join(ints, " "));
+  EXPECT_EQ("1,0,1", rcpputils::join(std::vector<bool>{true, false, true}, ","));
+}
+
+TEST(test_join, join_other_types) {
+  EXPECT_EQ("a-b-c", rcpputils::join(std::vector<char>{'a', 'b', 'c'}, "-"));
+  EXPECT_EQ("a, b", rcpputils::join(std::vector<const char *>{"a", "b"}, ", "));
+  EXPECT_EQ(
+    "a|bc|", rcpputils::join(std::vector<std::string_view>{"a", "bc", ""}, "|"));
+  EXPECT_EQ(L"x::y", rcpputils::join(std::vector<std::wstring>{L"x", L"y"}, L"::"));
+  EXPECT_EQ(L"1::2", rcpputils::join(std::vector<int>{1, 2}, L"::"));
+
+  // A null delimiter joins values without separating them.
+  const char * null_delim = nullptr;
+  EXPECT_EQ("foobar", rcpputils::join(std::vector<std::string>{"foo", "bar"}, null_delim));
+  EXPECT_EQ("12", rcpputils::join(std::vector<int>{1, 2}, null_delim));
+
+  // Types without a faster path fall back to their stream insertion operator.
+  const std::vector<std::complex<int>> complex{{1, 2}, {3, 4}};
+  EXPECT_EQ("(1,2) (3,4)", rcpputils::join(complex, " "));
+}
+
+TEST(test_join, join_ranges) {
+  EXPECT_EQ("1, 2, 3", rcpputils::join(std::array<int, 3>{1, 2, 3}, ", "));
+  EXPECT_EQ("a b c", rcpputils::join(std::set<std::string>{"c", "a", "b"}, " "));
+  const int raw[] = {4, 5};
+  EXPECT_EQ("4+5", rcpputils::join(raw, "+"));
+  EXPECT_EQ("a,b,c", rcpputils::join(std::string_view("abc"), ","));
+  EXPECT_EQ("", rcpputils::join(std::set<int>{}, ","));
+
+  const std::vector<std::string> strings{"foo", "bar", "baz"};
+  EXPECT_EQ("bar/baz", rcpputils::join(strings.begin() + 1, strings.end(), "/"));
+  EXPECT_EQ("5", rcpputils::join(raw + 1, raw + 2, "+"));
+  std::istringstream words("x y z");
+  EXPECT_EQ(
+    "x|y|z", rcpputils::join(
+      std::istream_iterator<std::string>(words), std::istream_iterator<std::string>(), "|"));
+}
+
+TEST(test_join, join_formatter) {
+  const std::map<std::string, int> params{{"a", 1}, {"b", 2}};
+  // Formatter returning a value to be formatted in place of the element.
+  EXPECT_EQ(
+    "a, b", rcpputils::join(params, ", ", [](const auto & kv) {return kv.first;}));
+  EXPECT_EQ(
+    "2;4", rcpputils::join(std::vector<int>{1, 2}, ";", [](int i) {return i * 2;}));
+  // Formatter appending to the output itself.
+  EXPECT_EQ(
+    "a=1, b=2", rcpputils::join(
+      params, ", ", [](std::string & out, const auto & kv) {
+        out.append(kv.first).append("=").append(std::to_string(kv.second));
+      }));
+}
+
+TEST(test_join, join_append_and_join_to) {
+  std::string out = "values: ";
+  rcpputils::join_append(out, std::vector<int>{1, 2, 3}, ", ");
+  EXPECT_EQ("values: 1, 2, 3", out);
+  const std::vector<std::string_view> views{"x", "y"};
+  rcpputils::join_append(out, views.begin(), views.end(), "");
+  EXPECT_EQ("values: 1, 2, 3xy", out);
+
+  std::string target;
+  rcpputils::join_to(std::back_inserter(target), std::list<double>{0.5, 2}, " ");
+  EXPECT_EQ("0.5 2", target);
+  char buffer[32] = {};
+  const std::map<int, char> letters{{1, 'a'}, {2, 'b'}};
+  char * const end = rcpputils::join_to(
+    buffer, letters, ",", [](char * it, const auto & kv) {
+      *it++ = kv.second;
+      *it++ = static_cast<char>('0' + kv.first);
+      return it;
+    });
+  EXPECT_EQ("a1,b2", std::string(buffer, end));
+  std::wstring wide;
+  rcpputils::join_to(
+    std::back_inserter(wide), std::array<int, 2>{7, 8}, L"; ", [](int i) {return i + 1;});
+  EXPECT_EQ(L"8; 9", wide);
+}
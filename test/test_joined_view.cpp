@@ -0,0 +1,131 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "rcpputils/join.hpp"
+#include "rcpputils/joined_view.hpp"
+
+TEST(test_joined_view, pieces) {
+  const std::vector<std::string> strings{"foo", "", "bar"};
+  const rcpputils::joined_view view(strings, ", ");
+  const std::vector<std::string_view> pieces(view.begin(), view.end());
+  EXPECT_EQ((std::vector<std::string_view>{"foo", ", ", ", ", "bar"}), pieces);
+  EXPECT_EQ("foo, , bar", view.str());
+  EXPECT_EQ(rcpputils::join(strings, ", "), view.str());
+  EXPECT_EQ(view.str().size(), view.size());
+
+  const std::array<const char *, 3> words{"a", "b", "c"};
+  EXPECT_EQ("abc", rcpputils::joined_view(words, "").str());
+  EXPECT_EQ(3u, rcpputils::joined_view(words, "").size());
+
+  const std::vector<std::string_view> none;
+  const rcpputils::joined_view empty(none, "/");
+  EXPECT_EQ(empty.begin(), empty.end());
+  EXPECT_EQ(0u, empty.size());
+  const std::vector<std::string_view> blanks{"", ""};
+  EXPECT_EQ("/", rcpputils::joined_view(blanks, "/").str());
+}
+
+#ifndef _WIN32
+namespace
+{
+std::string
+read_all(int fd)
+{
+  std::string result;
+  char buffer[4096];
+  for (;;) {
+    const ssize_t count = ::read(fd, buffer, sizeof(buffer));
+    if (count <= 0) {
+      return result;
+    }
+    result.append(buffer, static_cast<std::size_t>(count));
+  }
+}
+}  // namespace
+
+TEST(test_joined_view, fill_iovec) {
+  const std::vector<std::string> strings{"x", "yy", "zzz"};
+  const rcpputils::joined_view view(strings, "-");
+  iovec iov[2];
+  auto position = view.begin();
+  std::string collected;
+  std::size_t batches = 0;
+  while (std::size_t count = view.fill_iovec(position, iov, 2)) {
+    for (std::size_t i = 0; i < count; ++i) {
+      collected.append(static_cast<const char *>(iov[i].iov_base), iov[i].iov_len);
+    }
+    ++batches;
+  }
+  EXPECT_EQ("x-yy-zzz", collected);
+  EXPECT_EQ(3u, batches);
+}
+
+TEST(test_joined_view, writev_all_partial_writes) {
+  // Many more pieces than IOV_MAX, through a non-blocking socket with a small send buffer,
+  // so that writes are split up and must wait for the reader.
+  std::vector<std::string> lines;
+  for (int i = 0; i < 20000; ++i) {
+    lines.push_back("line " + std::to_string(i));
+  }
+  const rcpputils::joined_view view(lines, "\n");
+  int fds[2];
+  ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+  const int size = 4096;
+  ASSERT_EQ(0, ::setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)));
+  ASSERT_EQ(0, ::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | O_NONBLOCK));
+
+  std::string received;
+  std::thread reader([&received, fd = fds[1]]() {received = read_all(fd);});
+  EXPECT_EQ(view.size(), rcpputils::writev_all(fds[0], view));
+  ::close(fds[0]);
+  reader.join();
+  ::close(fds[1]);
+  EXPECT_EQ(view.str(), received);
+}
+
+TEST(test_joined_view, pwritev_all) {
+  char path[] = "/tmp/test_joined_view_XXXXXX";
+  const int fd = ::mkstemp(path);
+  ASSERT_GE(fd, 0);
+  ::unlink(path);
+  ASSERT_EQ(8, ::write(fd, "........", 8));
+
+  const std::vector<std::string_view> parts{"ab", "cd"};
+  EXPECT_EQ(5u, rcpputils::pwritev_all(fd, rcpputils::joined_view(parts, "+"), 2));
+  std::string header = "HEAD";
+  iovec iov[] = {{&header[0], 2}, {nullptr, 0}, {&header[2], 2}};
+  EXPECT_EQ(4u, rcpputils::pwritev_all(fd, iov, 3, 8));
+  ASSERT_EQ(0, ::lseek(fd, 0, SEEK_SET));
+  EXPECT_EQ("..ab+cd.HEAD", read_all(fd));
+
+  EXPECT_THROW(rcpputils::writev_all(-1, iov, 3), std::system_error);
+  ::close(fd);
+}
+#endif
@@ -14,10 +14,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -314,3 +318,402 @@ TEST(test_split, custom_iterator_exception)
   TripleExtractor triple_it;
   ASSERT_THROW(rcpputils::split(s, '/', triple_it), std::out_of_range);
 }
+
+TEST(test_split, split_view)
+{
+  {
+    rcpputils::split_view view("", '/');
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(view.begin(), view.end());
+  }
+  {
+    rcpputils::split_view view("/my//hello//world/", '/');
+    std::vector<std::string_view> tokens(view.begin(), view.end());
+    ASSERT_EQ(6u, tokens.size());
+    EXPECT_EQ("", tokens[0]);
+    EXPECT_EQ("my", tokens[1]);
+    EXPECT_EQ("", tokens[2]);
+    EXPECT_EQ("hello", tokens[3]);
+    EXPECT_EQ("", tokens[4]);
+    EXPECT_EQ("world", tokens[5]);
+  }
+  {
+    rcpputils::split_view view("/my//hello//world/", '/', true);
+    std::vector<std::string_view> tokens;
+    for (const auto token : view) {
+      tokens.push_back(token);
+    }
+    ASSERT_EQ(3u, tokens.size());
+    EXPECT_EQ("my", tokens[0]);
+    EXPECT_EQ("hello", tokens[1]);
+    EXPECT_EQ("world", tokens[2]);
+  }
+  {
+    rcpputils::split_view view("//", '/', true);
+    EXPECT_TRUE(view.empty());
+  }
+  {
+    rcpputils::split_view view("/", '/');
+    ASSERT_EQ(1, std::distance(view.begin(), view.end()));
+    EXPECT_EQ("", *view.begin());
+  }
+}
+
+TEST(test_split, split_view_points_into_input)
+{
+  const std::string input = "a:bb:ccc";
+  rcpputils::split_view view(input, ':');
+  auto it = view.begin();
+  EXPECT_EQ(input.data(), it->data());
+  ++it;
+  EXPECT_EQ(input.data() + 2, it->data());
+  EXPECT_EQ(2u, it->size());
+  EXPECT_EQ(1, std::count(view.begin(), view.end(), "ccc"));
+  EXPECT_NE(view.end(), std::find(view.begin(), view.end(), "bb"));
+}
+
+TEST(test_split, split_view_matches_split)
+{
+  const std::vector<std::string> inputs = {
+    "", "/", "//", "a", "a/", "/a", "a//b", "//a//b//", "lib:/opt/ros/lib::/usr/lib:"};
+  for (const auto & input : inputs) {
+    for (bool skip_empty : {false, true}) {
+      auto expected = rcpputils::split(input, '/', skip_empty);
+      rcpputils::split_view view(input, '/', skip_empty);
+      std::vector<std::string> actual(view.begin(), view.end());
+      EXPECT_EQ(expected, actual) << "input: '" << input << "' skip_empty: " << skip_empty;
+    }
+  }
+}
+
+TEST(test_split, delimiter_set)
+{
+  rcpputils::delimiter_set delims(" \t\n \t");
+  EXPECT_EQ(3u, delims.size());
+  EXPECT_EQ(" \t\n", delims.chars());
+  EXPECT_TRUE(delims.contains('\t'));
+  EXPECT_FALSE(delims.contains('a'));
+  EXPECT_FALSE(delims.contains('\0'));
+
+  std::string all_chars;
+  for (int c = 0; c < 256; ++c) {
+    all_chars.push_back(static_cast<char>(c));
+  }
+  rcpputils::delimiter_set all(all_chars);
+  EXPECT_EQ(256u, all.size());
+  EXPECT_TRUE(all.chars().empty());
+  EXPECT_TRUE(all.contains('\xff'));
+}
+
+TEST(test_split, split_delimiter_set)
+{
+  const rcpputils::delimiter_set delims(":;,");
+  {
+    auto ret = rcpputils::split("", delims);
+    EXPECT_EQ(0u, ret.size());
+  }
+  {
+    auto ret = rcpputils::split("a:b;c,d", delims);
+    ASSERT_EQ(4u, ret.size());
+    EXPECT_EQ("a", ret[0]);
+    EXPECT_EQ("b", ret[1]);
+    EXPECT_EQ("c", ret[2]);
+    EXPECT_EQ("d", ret[3]);
+  }
+  {
+    auto ret = rcpputils::split(";a:,b;", delims, false);
+    ASSERT_EQ(4u, ret.size());
+    EXPECT_EQ("", ret[0]);
+    EXPECT_EQ("a", ret[1]);
+    EXPECT_EQ("", ret[2]);
+    EXPECT_EQ("b", ret[3]);
+  }
+  {
+    auto ret = rcpputils::split(";a:,b;", delims, true);
+    ASSERT_EQ(2u, ret.size());
+    EXPECT_EQ("a", ret[0]);
+    EXPECT_EQ("b", ret[1]);
+  }
+}
+
+TEST(test_split, split_delimiter_set_long_input)
+{
+  // Exercise the vectorized scan across block boundaries and the scalar tail.
+  for (const std::string & chars : {std::string(" "), std::string(" \t\r\n"),
+      std::string("abcdefghijklmnopq")})
+  {
+    const rcpputils::delimiter_set delims(chars);
+    for (std::size_t length = 0; length < 100; ++length) {
+      for (std::size_t delim_pos = 0; delim_pos <= length; ++delim_pos) {
+        std::string input(length, '_');
+        if (delim_pos < length) {
+          input[delim_pos] = chars.back();
+        }
+        EXPECT_EQ(
+          input.find_first_of(chars),
+          rcpputils::detail::find_first_of(input, 0, delims));
+        EXPECT_EQ(
+          input.find_first_of(chars, delim_pos / 2),
+          rcpputils::detail::find_first_of(input, delim_pos / 2, delims));
+      }
+    }
+  }
+  std::string path_list;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 500; ++i) {
+    expected.push_back("/opt/ros/path_" + std::to_string(i));
+    path_list += expected.back() + (i % 2 ? ":" : ";");
+  }
+  EXPECT_EQ(expected, rcpputils::split(path_list, rcpputils::delimiter_set(":;")));
+}
+
+TEST(test_split, split_string_delimiter)
+{
+  {
+    auto ret = rcpputils::split("", "::");
+    EXPECT_EQ(0u, ret.size());
+  }
+  {
+    auto ret = rcpputils::split("my_pkg::msg::MyMessage", "::");
+    ASSERT_EQ(3u, ret.size());
+    EXPECT_EQ("my_pkg", ret[0]);
+    EXPECT_EQ("msg", ret[1]);
+    EXPECT_EQ("MyMessage", ret[2]);
+  }
+  {
+    auto ret = rcpputils::split("::a::::b::", "::", false);
+    ASSERT_EQ(4u, ret.size());
+    EXPECT_EQ("", ret[0]);
+    EXPECT_EQ("a", ret[1]);
+    EXPECT_EQ("", ret[2]);
+    EXPECT_EQ("b", ret[3]);
+  }
+  {
+    auto ret = rcpputils::split("::a::::b::", "::", true);
+    ASSERT_EQ(2u, ret.size());
+    EXPECT_EQ("a", ret[0]);
+    EXPECT_EQ("b", ret[1]);
+  }
+  {
+    auto ret = rcpputils::split("a:::b", "::");
+    ASSERT_EQ(2u, ret.size());
+    EXPECT_EQ("a", ret[0]);
+    EXPECT_EQ(":b", ret[1]);
+  }
+  {
+    auto ret = rcpputils::split("a, b,c", std::string(", "));
+    ASSERT_EQ(2u, ret.size());
+    EXPECT_EQ("a", ret[0]);
+    EXPECT_EQ("b,c", ret[1]);
+  }
+  {
+    auto ret = rcpputils::split("a::b", "");
+    ASSERT_EQ(1u, ret.size());
+    EXPECT_EQ("a::b", ret[0]);
+  }
+}
+
+TEST(test_split, split_compiled_delimiter)
+{
+  const rcpputils::compiled_delimiter delim(" -> ");
+  EXPECT_EQ(" -> ", delim.str());
+  EXPECT_EQ(4u, delim.size());
+  {
+    auto ret = rcpputils::split("a -> b ->  -> c -> ", delim);
+    ASSERT_EQ(4u, ret.size());
+    EXPECT_EQ("a", ret[0]);
+    EXPECT_EQ("b", ret[1]);
+    EXPECT_EQ("", ret[2]);
+    EXPECT_EQ("c", ret[3]);
+  }
+  {
+    auto ret = rcpputils::split("a -> b ->  -> c -> ", delim, true);
+    ASSERT_EQ(3u, ret.size());
+    EXPECT_EQ("c", ret[2]);
+  }
+  {
+    rcpputils::split_view view("x -> y", delim);
+    std::vector<std::string_view> tokens(view.begin(), view.end());
+    ASSERT_EQ(2u, tokens.size());
+    EXPECT_EQ("x", tokens[0]);
+    EXPECT_EQ("y", tokens[1]);
+  }
+  {
+    // Copies must search with their own pattern storage.
+    rcpputils::compiled_delimiter copy(delim);
+    rcpputils::compiled_delimiter assigned("unused");
+    assigned = copy;
+    EXPECT_EQ(1u, assigned.find("a -> b"));
+    EXPECT_EQ(std::string_view::npos, assigned.find("a -> b", 2));
+  }
+  {
+    const rcpputils::compiled_delimiter empty("");
+    auto ret = rcpputils::split("a b", empty);
+    ASSERT_EQ(1u, ret.size());
+    EXPECT_EQ("a b", ret[0]);
+  }
+}
+
+TEST(test_split, split_into_views)
+{
+  std::vector<std::string_view> out;
+  const std::string first = "/my//hello/world";
+  rcpputils::split_into(first, '/', out);
+  ASSERT_EQ(5u, out.size());
+  EXPECT_EQ("", out[0]);
+  EXPECT_EQ("my", out[1]);
+  EXPECT_EQ("", out[2]);
+  EXPECT_EQ("hello", out[3]);
+  EXPECT_EQ("world", out[4]);
+
+  const auto capacity = out.capacity();
+  const auto * data = out.data();
+  rcpputils::split_into(first, '/', out, true);
+  ASSERT_EQ(3u, out.size());
+  EXPECT_EQ("my", out[0]);
+  EXPECT_EQ(capacity, out.capacity());
+  EXPECT_EQ(data, out.data());
+
+  rcpputils::split_into("a::b", "::", out);
+  ASSERT_EQ(2u, out.size());
+  EXPECT_EQ("a", out[0]);
+  EXPECT_EQ("b", out[1]);
+
+  rcpputils::split_into("a b\tc", rcpputils::delimiter_set(" \t"), out);
+  ASSERT_EQ(3u, out.size());
+  EXPECT_EQ("c", out[2]);
+
+  rcpputils::split_into("", '/', out);
+  EXPECT_TRUE(out.empty());
+  EXPECT_EQ(capacity, out.capacity());
+}
+
+TEST(test_split, split_into_strings)
+{
+  std::vector<std::string> out;
+  rcpputils::split_into("a_long_token_that_is_heap_allocated/b/c", '/', out);
+  ASSERT_EQ(3u, out.size());
+  EXPECT_EQ("a_long_token_that_is_heap_allocated", out[0]);
+  const auto * buffer = out[0].data();
+
+  rcpputils::split_into("another_token_shorter_than_before/d", '/', out);
+  ASSERT_EQ(2u, out.size());
+  EXPECT_EQ("another_token_shorter_than_before", out[0]);
+  EXPECT_EQ("d", out[1]);
+  EXPECT_EQ(buffer, out[0].data());
+
+  const rcpputils::compiled_delimiter delim(", ");
+  rcpputils::split_into("x, y, z, w", delim, out);
+  EXPECT_EQ(std::vector<std::string>({"x", "y", "z", "w"}), out);
+}
+
+TEST(test_split, split_parallel_matches_split)
+{
+  std::string input;
+  for (int i = 0; i < 2000; ++i) {
+    input += "line_" + std::to_string(i) + (i % 3 ? "\n" : "\n\n");
+  }
+  const std::vector<std::string> inputs = {
+    "", "/", "//", "a", "a/", "/a", "a//b", "//a//b//", "/my//hello//world/", input};
+  for (const auto & in : inputs) {
+    for (bool skip_empty : {false, true}) {
+      for (std::size_t threads : {1u, 2u, 3u, 8u}) {
+        for (std::size_t chunk : {1u, 3u, 1000u}) {
+          const char delim = &in == &inputs.back() ? '\n' : '/';
+          EXPECT_EQ(
+            rcpputils::split(in, delim, skip_empty),
+            rcpputils::split_parallel(in, delim, skip_empty, threads, chunk)) <<
+            "input: '" << in << "' skip_empty: " << skip_empty << " threads: " << threads;
+        }
+      }
+    }
+  }
+  const rcpputils::delimiter_set delims("\n_");
+  EXPECT_EQ(
+    rcpputils::split(input, delims), rcpputils::split_parallel(input, delims, false, 4, 64));
+  EXPECT_EQ(rcpputils::split(input, '\n'), rcpputils::split_parallel(input, '\n'));
+}
+
+TEST(test_split, split_array_constexpr)
+{
+  static constexpr std::string_view name = "/my_ns//sub/my_node";
+  constexpr auto parts =
+    rcpputils::split_array<rcpputils::split_count(name, '/', true)>(name, '/', true);
+  static_assert(parts.size() == 3, "unexpected token count");
+  static_assert(parts[0] == "my_ns", "unexpected token");
+  static_assert(parts[1] == "sub", "unexpected token");
+  static_assert(parts[2] == "my_node", "unexpected token");
+
+  constexpr auto all_parts =
+    rcpputils::split_array<rcpputils::split_count(name, '/')>(name, '/');
+  static_assert(all_parts.size() == 5, "unexpected token count");
+  static_assert(all_parts[0].empty() && all_parts[2].empty(), "unexpected token");
+
+  static_assert(rcpputils::split_count("", '/') == 0, "unexpected token count");
+  static_assert(rcpputils::split_count("a/b/", '/') == 2, "unexpected token count");
+  static_assert(rcpputils::split_array<0>("", '/').empty(), "unexpected token count");
+
+  const std::string input = "a/b/c";
+  auto runtime_parts = rcpputils::split_array<3>(input, '/');
+  EXPECT_EQ("c", runtime_parts[2]);
+  EXPECT_THROW(rcpputils::split_array<2>(input, '/'), std::length_error);
+  EXPECT_THROW(rcpputils::split_array<4>(input, '/'), std::length_error);
+}
+
+TEST(test_split, split_n)
+{
+  using strings = std::vector<std::string>;
+  EXPECT_EQ(strings(), rcpputils::split_n("a/b/c", '/', 0));
+  EXPECT_EQ(strings(), rcpputils::split_n("", '/', 2));
+  EXPECT_EQ(strings({"a/b/c"}), rcpputils::split_n("a/b/c", '/', 1));
+  EXPECT_EQ(strings({"a", "b/c"}), rcpputils::split_n("a/b/c", '/', 2));
+  EXPECT_EQ(strings({"a", "b", "c"}), rcpputils::split_n("a/b/c", '/', 3));
+  EXPECT_EQ(strings({"a", "b", "c"}), rcpputils::split_n("a/b/c", '/', 10));
+  EXPECT_EQ(strings({"a", "b"}), rcpputils::split_n("a/b/", '/', 2));
+  EXPECT_EQ(strings({"a", "b/c/"}), rcpputils::split_n("a/b/c/", '/', 2));
+  EXPECT_EQ(strings({"a", "/b"}), rcpputils::split_n("a//b", '/', 2));
+  EXPECT_EQ(strings({"a", "b//c"}), rcpputils::split_n("/a//b//c", '/', 2, true));
+  EXPECT_EQ(strings({"pkg", "msg::Type"}), rcpputils::split_n("pkg::msg::Type", "::", 2));
+
+  const std::vector<std::string> inputs = {
+    "", "/", "//", "a", "a/", "/a", "a//b", "//a//b//", "/my//hello//world/"};
+  for (const auto & input : inputs) {
+    for (bool skip_empty : {false, true}) {
+      EXPECT_EQ(
+        rcpputils::split(input, '/', skip_empty), rcpputils::split_n(input, '/', 100, skip_empty));
+    }
+  }
+}
+
+TEST(test_split, rsplit_n)
+{
+  using strings = std::vector<std::string>;
+  EXPECT_EQ(strings(), rcpputils::rsplit_n("a/b/c", '/', 0));
+  EXPECT_EQ(strings(), rcpputils::rsplit_n("", '/', 2));
+  EXPECT_EQ(strings({"a/b/c"}), rcpputils::rsplit_n("a/b/c", '/', 1));
+  EXPECT_EQ(strings({"a/b", "c"}), rcpputils::rsplit_n("a/b/c", '/', 2));
+  EXPECT_EQ(strings({"a", "b", "c"}), rcpputils::rsplit_n("a/b/c", '/', 3));
+  EXPECT_EQ(strings({"a/b", "c"}), rcpputils::rsplit_n("a/b/c/", '/', 2));
+  EXPECT_EQ(strings({"a/b/c/"}), rcpputils::rsplit_n("a/b/c/", '/', 1));
+  EXPECT_EQ(strings({"a,b,"}), rcpputils::rsplit_n("a,b,", ',', 1));
+  EXPECT_EQ(rcpputils::split_n("a,b,", ',', 1), rcpputils::rsplit_n("a,b,", ',', 1));
+  EXPECT_EQ(strings({"a,b"}), rcpputils::rsplit_n("a,b,,", ',', 1, true));
+  EXPECT_EQ(strings({"a/", "b"}), rcpputils::rsplit_n("a//b", '/', 2));
+  EXPECT_EQ(strings({"/a", "b"}), rcpputils::rsplit_n("/a//b//", '/', 2, true));
+  EXPECT_EQ(strings({"archive.tar", "gz"}), rcpputils::rsplit_n("archive.tar.gz", '.', 2));
+  EXPECT_EQ(strings({"pkg::msg", "Type"}), rcpputils::rsplit_n("pkg::msg::Type", "::", 2));
+  EXPECT_EQ(
+    strings({"a b", "c"}),
+    rcpputils::rsplit_n("a b \t c", rcpputils::delimiter_set(" \t"), 2, true));
+
+  const std::vector<std::string> inputs = {
+    "", "/", "//", "a", "a/", "/a", "a//b", "//a//b//", "/my//hello//world/"};
+  for (const auto & input : inputs) {
+    for (bool skip_empty : {false, true}) {
+      EXPECT_EQ(
+        rcpputils::split(input, '/', skip_empty),
+        rcpputils::rsplit_n(input, '/', 100, skip_empty)) <<
+        "input: '" << input << "' skip_empty: " << skip_empty;
+    }
+  }
+}
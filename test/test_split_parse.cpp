@@ -0,0 +1,105 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "rcpputils/split_parse.hpp"
+
+TEST(test_split_parse, integers)
+{
+  {
+    auto ret = rcpputils::split_parse<int>("1,-2, 3 ,+4", ',');
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(std::vector<int>({1, -2, 3, 4}), *ret);
+  }
+  {
+    auto ret = rcpputils::split_parse<int>("", ',');
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_TRUE(ret->empty());
+  }
+  {
+    auto ret = rcpputils::split_parse<std::uint8_t>("1 2  255", ' ', true);
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(std::vector<std::uint8_t>({1, 2, 255}), *ret);
+  }
+}
+
+TEST(test_split_parse, floating_point)
+{
+  auto ret = rcpputils::split_parse<double>("0.5;1e3;-2.25;  7", ';');
+  ASSERT_TRUE(ret.has_value());
+  EXPECT_EQ(std::vector<double>({0.5, 1000.0, -2.25, 7.0}), *ret);
+
+  auto covariance = rcpputils::split_parse<float>("1.0, 0.0, 0.0, 1.0", ", ");
+  ASSERT_TRUE(covariance.has_value());
+  EXPECT_EQ(std::vector<float>({1.0f, 0.0f, 0.0f, 1.0f}), *covariance);
+}
+
+TEST(test_split_parse, errors)
+{
+  {
+    const std::string input = "1,2,x3,4";
+    auto ret = rcpputils::split_parse<int>(input, ',');
+    ASSERT_FALSE(ret.has_value());
+    EXPECT_EQ(std::errc::invalid_argument, ret.error().error);
+    EXPECT_EQ(4u, ret.error().offset);
+    EXPECT_EQ("x3", ret.error().token);
+  }
+  {
+    auto ret = rcpputils::split_parse<int>("1,2.5", ',');
+    ASSERT_FALSE(ret.has_value());
+    EXPECT_EQ(std::errc::invalid_argument, ret.error().error);
+    EXPECT_EQ(2u, ret.error().offset);
+  }
+  {
+    auto ret = rcpputils::split_parse<std::int8_t>("1,300", ',');
+    ASSERT_FALSE(ret.has_value());
+    EXPECT_EQ(std::errc::result_out_of_range, ret.error().error);
+  }
+  {
+    auto ret = rcpputils::split_parse<int>("1,,2", ',');
+    ASSERT_FALSE(ret.has_value());
+    EXPECT_EQ(std::errc::invalid_argument, ret.error().error);
+    EXPECT_EQ(2u, ret.error().offset);
+    ret = rcpputils::split_parse<int>("1,,2", ',', true);
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(2u, ret->size());
+  }
+  {
+    auto ret = rcpputils::split_parse<double>("1, ,2", ',');
+    ASSERT_FALSE(ret.has_value());
+    EXPECT_EQ(std::errc::invalid_argument, ret.error().error);
+  }
+}
+
+TEST(test_split_parse, into_buffer)
+{
+  std::array<double, 4> values{};
+  auto ret = rcpputils::split_parse_into("1 2 3", ' ', values.data(), values.size());
+  ASSERT_TRUE(ret.has_value());
+  EXPECT_EQ(3u, *ret);
+  EXPECT_EQ(3.0, values[2]);
+
+  ret = rcpputils::split_parse_into(
+    "1 2 3 4 5", rcpputils::delimiter_set(" \t"), values.data(), values.size());
+  ASSERT_FALSE(ret.has_value());
+  EXPECT_EQ(std::errc::value_too_large, ret.error().error);
+  EXPECT_EQ(8u, ret.error().offset);
+}
@@ -0,0 +1,178 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#  include <io.h>
+#  define fileno _fileno
+#endif
+
+#include "rcpputils/split.hpp"
+#include "rcpputils/split_stream.hpp"
+
+namespace
+{
+std::vector<std::string>
+collect(rcpputils::stream_splitter & splitter)
+{
+  std::vector<std::string> tokens;
+  splitter.for_each(
+    [&tokens](std::string_view token) {
+      tokens.emplace_back(token);
+    });
+  return tokens;
+}
+
+std::string
+make_manifest(std::size_t lines)
+{
+  std::string manifest;
+  for (std::size_t i = 0; i < lines; ++i) {
+    manifest += "/opt/ros/lib_" + std::to_string(i) + ":entry" + (i % 7 ? "" : ":") + "\n";
+  }
+  return manifest;
+}
+
+struct temp_file
+{
+  explicit temp_file(const std::string & contents)
+  : file(std::tmpfile())
+  {
+    std::fwrite(contents.data(), 1, contents.size(), file);
+    std::fflush(file);
+    std::rewind(file);
+  }
+
+  ~temp_file()
+  {
+    std::fclose(file);
+  }
+
+  int fd() const
+  {
+    return fileno(file);
+  }
+
+  std::FILE * file;
+};
+}  // namespace
+
+TEST(test_split_stream, istream_matches_split)
+{
+  const std::vector<std::string> inputs = {
+    "", "/", "//", "a", "a/", "/a", "a//b", "//a//b//", "my/hello//world/"};
+  for (const auto & input : inputs) {
+    for (bool skip_empty : {false, true}) {
+      for (std::size_t buffer_size : {8u, 64u}) {
+        std::istringstream stream(input);
+        rcpputils::stream_splitter splitter(stream, '/', skip_empty, buffer_size);
+        EXPECT_EQ(rcpputils::split(input, '/', skip_empty), collect(splitter)) <<
+          "input: '" << input << "' skip_empty: " << skip_empty;
+      }
+    }
+  }
+}
+
+TEST(test_split_stream, small_buffer_large_input)
+{
+  const std::string manifest = make_manifest(5000);
+  const rcpputils::delimiter_set delims(":\n");
+  std::istringstream stream(manifest);
+  rcpputils::stream_splitter splitter(stream, delims, false, 32);
+  std::vector<std::string> tokens;
+  for (const auto token : splitter) {
+    tokens.emplace_back(token);
+  }
+  EXPECT_EQ(rcpputils::split(manifest, delims), tokens);
+}
+
+TEST(test_split_stream, token_longer_than_buffer)
+{
+  std::istringstream stream("short:this_token_does_not_fit:x");
+  rcpputils::stream_splitter splitter(stream, ':', false, 8);
+  std::string_view token;
+  ASSERT_TRUE(splitter.next(token));
+  EXPECT_EQ("short", token);
+  EXPECT_THROW(splitter.next(token), std::length_error);
+
+  std::istringstream empty;
+  EXPECT_THROW(rcpputils::stream_splitter(empty, ':', false, 0), std::invalid_argument);
+}
+
+TEST(test_split_stream, token_as_long_as_buffer)
+{
+  // A token may fill the whole buffer, whether a delimiter or the end of input follows it.
+  const std::vector<std::string> inputs = {
+    "12345678", "12345678:", "12345678:ab", "ab:12345678", "12345678:12345678:",
+    "1234567:12345678"};
+  for (const auto & input : inputs) {
+    std::istringstream stream(input);
+    rcpputils::stream_splitter splitter(stream, ':', false, 8);
+    EXPECT_EQ(rcpputils::split(input, ':'), collect(splitter)) << "input: '" << input << "'";
+  }
+
+  std::istringstream stream("123456789");
+  rcpputils::stream_splitter splitter(stream, ':', false, 8);
+  std::string_view token;
+  EXPECT_THROW(splitter.next(token), std::length_error);
+}
+
+TEST(test_split_stream, moved_from)
+{
+  std::istringstream stream("a:b");
+  rcpputils::stream_splitter splitter(stream, ':');
+  rcpputils::stream_splitter moved(std::move(splitter));
+  std::string_view token;
+  EXPECT_FALSE(splitter.next(token));
+  EXPECT_FALSE(splitter.is_mapped());
+  EXPECT_EQ((std::vector<std::string>{"a", "b"}), collect(moved));
+}
+
+TEST(test_split_stream, file_descriptor)
+{
+  const std::string manifest = make_manifest(2000);
+  const auto expected = rcpputils::split(manifest, rcpputils::delimiter_set(":\n"), true);
+  {
+    temp_file file(manifest);
+    rcpputils::stream_splitter splitter(
+      file.fd(), rcpputils::delimiter_set(":\n"), true, 100);
+    EXPECT_FALSE(splitter.is_mapped());
+    EXPECT_EQ(expected, collect(splitter));
+  }
+  {
+    temp_file file(manifest);
+    rcpputils::stream_splitter splitter(
+      file.fd(), rcpputils::delimiter_set(":\n"), true, 100, true);
+#ifndef _WIN32
+    EXPECT_TRUE(splitter.is_mapped());
+#endif
+    EXPECT_EQ(expected, collect(splitter));
+  }
+  {
+    // Empty files cannot be mapped and fall back to reading.
+    temp_file file("");
+    rcpputils::stream_splitter splitter(file.fd(), '\n', false, 16, true);
+    EXPECT_FALSE(splitter.is_mapped());
+    EXPECT_TRUE(collect(splitter).empty());
+  }
+}
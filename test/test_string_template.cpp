@@ -0,0 +1,104 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "rcpputils/env.hpp"
+#include "rcpputils/string_template.hpp"
+
+TEST(test_string_template, keys) {
+  EXPECT_TRUE(rcpputils::string_template("").keys().empty());
+  EXPECT_TRUE(rcpputils::string_template("no placeholders").keys().empty());
+  const rcpputils::string_template tmpl("{ns}/{node}/{ns}_{index}");
+  EXPECT_EQ((std::vector<std::string>{"ns", "node", "index"}), tmpl.keys());
+}
+
+TEST(test_string_template, render_values) {
+  const rcpputils::string_template tmpl("/log/{node}_{stamp}.log");
+  std::string output;
+  tmpl.render(std::vector<std::string_view>{"talker", "1234"}, output);
+  EXPECT_EQ("/log/talker_1234.log", output);
+
+  // Rendering appends, reusing the caller's buffer.
+  output = "path: ";
+  const auto capacity = output.capacity();
+  tmpl.render(std::vector<std::string_view>{"listener", "5"}, output);
+  EXPECT_EQ("path: /log/listener_5.log", output);
+  EXPECT_GE(output.capacity(), capacity);
+
+  EXPECT_THROW(tmpl.render(std::vector<std::string_view>{"x"}, output), std::invalid_argument);
+  EXPECT_EQ("plain", rcpputils::string_template("plain").render(std::vector<std::string_view>{}));
+}
+
+TEST(test_string_template, render_map) {
+  const rcpputils::string_template tmpl("{a}{b}-{a}");
+  const std::unordered_map<std::string, std::string> values{{"a", "1"}, {"b", "22"}, {"c", "x"}};
+  EXPECT_EQ("122-1", tmpl.render(values));
+  const std::map<std::string, std::string> ordered{{"a", ""}, {"b", "b"}};
+  EXPECT_EQ("b-", tmpl.render(ordered));
+  const std::map<std::string, std::string> missing{{"a", "1"}};
+  EXPECT_THROW(tmpl.render(missing), std::out_of_range);
+}
+
+TEST(test_string_template, render_callback) {
+  const rcpputils::string_template tmpl("<{x}|{y}>");
+  EXPECT_EQ(
+    "<x!|y!>", tmpl.render([](const std::string & key) {return key + "!";}));
+  EXPECT_EQ(
+    "<v|v>", tmpl.render([](const std::string &) {return std::string_view("v");}));
+  EXPECT_EQ("<c|c>", tmpl.render([](const std::string &) {return "c";}));
+
+  // More placeholders than are resolved on the stack.
+  std::string text;
+  std::string expected;
+  for (int i = 0; i < 40; ++i) {
+    text += "{k" + std::to_string(i) + "},";
+    expected += "k" + std::to_string(i) + "=,";
+  }
+  EXPECT_EQ(
+    expected, rcpputils::string_template(text).render(
+      [](const std::string & key) {return key + "=";}));
+}
+
+TEST(test_string_template, render_env) {
+  ASSERT_TRUE(rcpputils::set_env_var("RCPPUTILS_TEMPLATE_TEST_VAR", "value"));
+  const rcpputils::string_template tmpl(
+    "{RCPPUTILS_TEMPLATE_TEST_VAR}/{RCPPUTILS_TEMPLATE_TEST_UNSET}");
+  EXPECT_EQ("value/", tmpl.render(rcpputils::env_resolver()));
+  ASSERT_TRUE(rcpputils::set_env_var("RCPPUTILS_TEMPLATE_TEST_VAR", nullptr));
+  EXPECT_EQ("/", tmpl.render(rcpputils::env_resolver()));
+}
+
+TEST(test_string_template, escapes) {
+  const auto none = std::vector<std::string_view>{};
+  EXPECT_EQ("{}", rcpputils::string_template("{{}}").render(none));
+  EXPECT_EQ("a{b}c", rcpputils::string_template("a{{b}}c").render(none));
+  EXPECT_EQ(
+    "{x}", rcpputils::string_template("{{{k}}}").render(std::vector<std::string_view>{"x"}));
+}
+
+TEST(test_string_template, invalid) {
+  EXPECT_THROW(rcpputils::string_template("{"), std::invalid_argument);
+  EXPECT_THROW(rcpputils::string_template("{a"), std::invalid_argument);
+  EXPECT_THROW(rcpputils::string_template("{a{b}}"), std::invalid_argument);
+  EXPECT_THROW(rcpputils::string_template("a}"), std::invalid_argument);
+  EXPECT_THROW(rcpputils::string_template("{}"), std::invalid_argument);
+}
@@ -14,6 +14,16 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
 #include <rcpputils/time.hpp>
 
 #include "rcutils/time.h"
@@ -29,3 +39,290 @@ TEST(test_time, test_convert_to_nanoseconds) {
     rcpputils::convert_to_nanoseconds(std::chrono::hours(10000000)),
     std::invalid_argument);
 }
+
+TEST(test_time, test_convert_to_nanoseconds_limits) {
+  using std::chrono::nanoseconds;
+  EXPECT_EQ(nanoseconds::max(), rcpputils::convert_to_nanoseconds(nanoseconds::max()));
+  EXPECT_EQ(nanoseconds::min(), rcpputils::convert_to_nanoseconds(nanoseconds::min()));
+  // The largest whole number of seconds which fits, which a double round trip cannot represent.
+  const std::chrono::seconds max_seconds(nanoseconds::max().count() / 1000000000);
+  EXPECT_EQ(
+    max_seconds.count() * 1000000000, rcpputils::convert_to_nanoseconds(max_seconds).count());
+  EXPECT_THROW(
+    rcpputils::convert_to_nanoseconds(max_seconds + std::chrono::seconds(1)),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rcpputils::convert_to_nanoseconds(std::chrono::hours(-10000000)), std::invalid_argument);
+  EXPECT_THROW(
+    rcpputils::convert_to_nanoseconds(
+      std::chrono::duration<double>(std::numeric_limits<double>::quiet_NaN())),
+    std::invalid_argument);
+  try {
+    rcpputils::convert_to_nanoseconds(
+      std::chrono::duration<double>(std::numeric_limits<double>::quiet_NaN()));
+    FAIL() << "NaN was converted";
+  } catch (const std::invalid_argument & e) {
+    EXPECT_STREQ("time must not be NaN", e.what());
+  }
+}
+
+TEST(test_time, test_checked_duration_cast) {
+  using std::chrono::milliseconds;
+  using std::chrono::nanoseconds;
+  using std::chrono::seconds;
+
+  static_assert(
+    rcpputils::checked_duration_cast<nanoseconds>(seconds(2)).value() == nanoseconds(2000000000),
+    "checked_duration_cast is constexpr");
+  EXPECT_EQ(
+    milliseconds(1500),
+    rcpputils::checked_duration_cast<milliseconds>(nanoseconds(1500999999)).value());
+  EXPECT_EQ(
+    milliseconds(-1500),
+    rcpputils::checked_duration_cast<milliseconds>(nanoseconds(-1500999999)).value());
+  EXPECT_EQ(
+    std::errc::result_out_of_range,
+    rcpputils::checked_duration_cast<nanoseconds>(std::chrono::hours(10000000)).error());
+  EXPECT_EQ(
+    std::errc::result_out_of_range,
+    rcpputils::checked_duration_cast<nanoseconds>(std::chrono::hours(-10000000)).error());
+
+  // Narrowing and signedness changes.
+  using ms32 = std::chrono::duration<int32_t, std::milli>;
+  using ns_unsigned = std::chrono::duration<uint64_t, std::nano>;
+  EXPECT_EQ(ms32(2147483000), rcpputils::checked_duration_cast<ms32>(seconds(2147483)).value());
+  EXPECT_FALSE(rcpputils::checked_duration_cast<ms32>(seconds(2147484)).has_value());
+  EXPECT_FALSE(rcpputils::checked_duration_cast<ns_unsigned>(nanoseconds(-1)).has_value());
+  EXPECT_EQ(
+    ns_unsigned(UINT64_MAX),
+    rcpputils::checked_duration_cast<ns_unsigned>(ns_unsigned(UINT64_MAX)).value());
+  EXPECT_FALSE(
+    rcpputils::checked_duration_cast<nanoseconds>(ns_unsigned(UINT64_MAX)).has_value());
+  // Above the range of the signed source rep, but within the range of the unsigned target.
+  EXPECT_EQ(
+    ns_unsigned(10000000000000000000u),
+    rcpputils::checked_duration_cast<ns_unsigned>(seconds(10000000000)).value());
+  EXPECT_FALSE(rcpputils::checked_duration_cast<ns_unsigned>(seconds(20000000000)).has_value());
+
+  // Periods which are not multiples of each other.
+  using thirds = std::chrono::duration<int64_t, std::ratio<1, 3>>;
+  using halves = std::chrono::duration<int64_t, std::ratio<1, 2>>;
+  EXPECT_EQ(halves(3), rcpputils::checked_duration_cast<halves>(thirds(5)).value());
+  EXPECT_EQ(halves(-3), rcpputils::checked_duration_cast<halves>(thirds(-5)).value());
+  // std::chrono::duration_cast overflows here, multiplying before dividing.
+  EXPECT_EQ(
+    halves(6148914691236517204),
+    rcpputils::checked_duration_cast<halves>(thirds(INT64_MAX)).value());
+  // The remainder times the numerator overflows although the result fits.
+  using odd_seconds = std::chrono::duration<int64_t, std::ratio<1000000007, 1000000009>>;
+  EXPECT_EQ(
+    nanoseconds(1000000006000000001),
+    rcpputils::checked_duration_cast<nanoseconds>(odd_seconds(1000000008)).value());
+  EXPECT_EQ(
+    nanoseconds(-1000000006000000001),
+    rcpputils::checked_duration_cast<nanoseconds>(odd_seconds(-1000000008)).value());
+
+  // Floating point reps.
+  EXPECT_EQ(
+    nanoseconds(1500000000),
+    rcpputils::checked_duration_cast<nanoseconds>(std::chrono::duration<double>(1.5)).value());
+  EXPECT_EQ(
+    std::errc::result_out_of_range,
+    rcpputils::checked_duration_cast<nanoseconds>(std::chrono::duration<double>(1e10)).error());
+  EXPECT_EQ(
+    std::errc::result_out_of_range,
+    rcpputils::checked_duration_cast<nanoseconds>(
+      std::chrono::duration<double, std::nano>(9223372036854775808.0)).error());
+  EXPECT_EQ(
+    std::errc::invalid_argument,
+    rcpputils::checked_duration_cast<nanoseconds>(
+      std::chrono::duration<double>(std::numeric_limits<double>::quiet_NaN())).error());
+  EXPECT_DOUBLE_EQ(
+    0.25,
+    rcpputils::checked_duration_cast<std::chrono::duration<double>>(milliseconds(250))
+    .value().count());
+}
+
+TEST(test_time, test_saturating_and_wrapping_duration_cast) {
+  using std::chrono::nanoseconds;
+  using std::chrono::seconds;
+  EXPECT_EQ(
+    nanoseconds::max(), rcpputils::saturating_duration_cast<nanoseconds>(seconds::max()));
+  EXPECT_EQ(
+    nanoseconds::min(), rcpputils::saturating_duration_cast<nanoseconds>(seconds::min()));
+  EXPECT_EQ(nanoseconds(5000), rcpputils::saturating_duration_cast<nanoseconds>(
+      std::chrono::microseconds(5)));
+  EXPECT_EQ(
+    nanoseconds::max(),
+    rcpputils::saturating_duration_cast<nanoseconds>(std::chrono::duration<double>(1e300)));
+  EXPECT_EQ(
+    nanoseconds::zero(),
+    rcpputils::saturating_duration_cast<nanoseconds>(
+      std::chrono::duration<double>(std::numeric_limits<double>::quiet_NaN())));
+
+  using ms8 = std::chrono::duration<int8_t, std::milli>;
+  EXPECT_EQ(ms8(-56), rcpputils::wrapping_duration_cast<ms8>(std::chrono::milliseconds(200)));
+  EXPECT_EQ(ms8(-24), rcpputils::wrapping_duration_cast<ms8>(seconds(1)));
+  const int64_t wrapped = static_cast<int64_t>(
+    static_cast<uint64_t>(seconds::max().count()) * 1000000000u);
+  EXPECT_EQ(
+    nanoseconds(wrapped), rcpputils::wrapping_duration_cast<nanoseconds>(seconds::max()));
+}
+
+TEST(test_time, test_parse_duration) {
+  using std::chrono::nanoseconds;
+  using namespace std::chrono_literals;
+  EXPECT_EQ(nanoseconds(1500000), rcpputils::parse_duration("1.5ms").value());
+  EXPECT_EQ(250us, rcpputils::parse_duration("250us").value());
+  EXPECT_EQ(250us, rcpputils::parse_duration("250\u00b5s").value());
+  EXPECT_EQ(250us, rcpputils::parse_duration("250\u03bcs").value());
+  EXPECT_EQ(2h, rcpputils::parse_duration("2h").value());
+  EXPECT_EQ(90min, rcpputils::parse_duration("1h30m").value());
+  EXPECT_EQ(3s, rcpputils::parse_duration("3s").value());
+  EXPECT_EQ(7ns, rcpputils::parse_duration("7ns").value());
+  EXPECT_EQ(500ms, rcpputils::parse_duration(".5s").value());
+  EXPECT_EQ(1s, rcpputils::parse_duration("1.s").value());
+  EXPECT_EQ(-1500ms, rcpputils::parse_duration("-1.5s").value());
+  EXPECT_EQ(1500ms, rcpputils::parse_duration("+1s500ms").value());
+  EXPECT_EQ(0ns, rcpputils::parse_duration("0").value());
+  EXPECT_EQ(0ns, rcpputils::parse_duration("-0").value());
+  EXPECT_EQ(0ns, rcpputils::parse_duration("0.0s").value());
+  // Exact fractions of units which are not powers of ten, truncated to nanoseconds.
+  EXPECT_EQ(nanoseconds(3600000000001), rcpputils::parse_duration("1.0000000000003h").value());
+  EXPECT_EQ(nanoseconds(1), rcpputils::parse_duration("1.999ns").value());
+  EXPECT_EQ(20ms, rcpputils::parse_duration("0.02000000000000000000000001s").value());
+
+  // The limits of std::chrono::nanoseconds.
+  EXPECT_EQ(
+    nanoseconds::max(), rcpputils::parse_duration("9223372036854775807ns").value());
+  EXPECT_EQ(
+    nanoseconds::min(), rcpputils::parse_duration("-9223372036854775808ns").value());
+  EXPECT_EQ(
+    nanoseconds::max(), rcpputils::parse_duration("2562047h47m16.854775807s").value());
+  for (const char * text : {
+      "9223372036854775808ns", "-9223372036854775809ns", "2562048h", "18446744073709551616ns",
+      "99999999999999999999h", "9223372036854775807ns1ns"})
+  {
+    EXPECT_EQ(std::errc::result_out_of_range, rcpputils::parse_duration(text).error()) << text;
+  }
+
+  for (const char * text : {
+      "", "-", "+", "1", "1.5", "s", ".s", "1x", "1 s", " 1s", "1s ", "1S", "1.2.3s", "--1s",
+      "1e3s", "1min", "0x10s", "1s-1s"})
+  {
+    EXPECT_EQ(std::errc::invalid_argument, rcpputils::parse_duration(text).error()) << text;
+  }
+}
+
+TEST(test_time, test_format_duration) {
+  using std::chrono::nanoseconds;
+  using namespace std::chrono_literals;
+  EXPECT_EQ("0s", rcpputils::format_duration(0ns));
+  EXPECT_EQ("7ns", rcpputils::format_duration(7ns));
+  EXPECT_EQ("250us", rcpputils::format_duration(250us));
+  EXPECT_EQ("1.001us", rcpputils::format_duration(1001ns));
+  EXPECT_EQ("1.5ms", rcpputils::format_duration(1500us));
+  EXPECT_EQ("999.999999ms", rcpputils::format_duration(999999999ns));
+  EXPECT_EQ("2.25s", rcpputils::format_duration(2250ms));
+  EXPECT_EQ("1m0s", rcpputils::format_duration(60s));
+  EXPECT_EQ("1h30m0s", rcpputils::format_duration(90min));
+  EXPECT_EQ("2h0m0.000000001s", rcpputils::format_duration(2h + 1ns));
+  EXPECT_EQ("-1.5ms", rcpputils::format_duration(-1500us));
+  EXPECT_EQ("2562047h47m16.854775807s", rcpputils::format_duration(nanoseconds::max()));
+  EXPECT_EQ("-2562047h47m16.854775808s", rcpputils::format_duration(nanoseconds::min()));
+  EXPECT_EQ(
+    rcpputils::max_duration_length, rcpputils::format_duration(nanoseconds::min()).size());
+
+  char buffer[4];
+  std::to_chars_result result = rcpputils::format_duration(buffer, buffer + 4, 1500us);
+  EXPECT_EQ(std::errc::value_too_large, result.ec);
+  EXPECT_EQ(buffer + 4, result.ptr);
+  result = rcpputils::format_duration(buffer, buffer + 4, 20ms);
+  EXPECT_EQ(std::errc(), result.ec);
+  EXPECT_EQ("20ms", std::string(buffer, result.ptr));
+
+  // Formatted durations parse back to themselves.
+  const std::vector<nanoseconds> durations = {
+    1ns, 999ns, 123456789ns, 59s, 3601s + 1ns, 100h, -42ms, nanoseconds::max(), nanoseconds::min()};
+  for (const nanoseconds duration : durations) {
+    const std::string text = rcpputils::format_duration(duration);
+    EXPECT_EQ(duration, rcpputils::parse_duration(text).value()) << text;
+  }
+}
+
+TEST(test_time, test_precise_sleep_until) {
+  using std::chrono::steady_clock;
+  const auto deadline = steady_clock::now() + std::chrono::milliseconds(5);
+  rcpputils::precise_sleep_until(deadline);
+  const auto woke = steady_clock::now();
+  EXPECT_GE(woke, deadline);
+  // Generous, as the test may be descheduled while spinning.
+  EXPECT_LT(woke - deadline, std::chrono::milliseconds(50));
+
+  // A deadline in the past returns immediately.
+  const auto past = steady_clock::now() - std::chrono::seconds(1);
+  rcpputils::precise_sleep_until(past, std::chrono::nanoseconds(0));
+  EXPECT_LT(steady_clock::now() - woke, std::chrono::milliseconds(50));
+}
+
+TEST(test_time, test_rate_loop) {
+  using std::chrono::milliseconds;
+  EXPECT_THROW(rcpputils::rate_loop(milliseconds(0)), std::invalid_argument);
+  EXPECT_THROW(
+    rcpputils::rate_loop(milliseconds(1), milliseconds(-1)), std::invalid_argument);
+
+  rcpputils::rate_loop loop(milliseconds(2));
+  EXPECT_EQ(milliseconds(2), loop.period());
+  const auto first_deadline = loop.next_deadline();
+  for (int i = 0; i < 10; ++i) {
+    loop.sleep();
+  }
+  const rcpputils::rate_loop_statistics stats = loop.statistics();
+  EXPECT_EQ(10u, stats.cycles);
+  // Deadlines are only missed by overrunning cycles, each of which may miss several.
+  if (0u == stats.overruns) {
+    EXPECT_EQ(0u, stats.missed_cycles);
+  }
+  // The schedule does not drift, whatever the lateness of each cycle.
+  EXPECT_EQ(
+    first_deadline + milliseconds(2) * static_cast<int>(stats.cycles + stats.missed_cycles),
+    loop.next_deadline());
+  EXPECT_GE(std::chrono::steady_clock::now(), first_deadline + milliseconds(18));
+  if (stats.overruns < stats.cycles) {
+    EXPECT_GE(stats.min_jitter.count(), 0);
+    EXPECT_LE(stats.min_jitter, stats.mean_jitter);
+    EXPECT_LE(stats.mean_jitter, stats.max_jitter);
+    EXPECT_GE(stats.jitter_stddev.count(), 0);
+  }
+}
+
+TEST(test_time, test_rate_loop_overrun) {
+  using std::chrono::milliseconds;
+  rcpputils::rate_loop loop(milliseconds(5));
+  const auto first_deadline = loop.next_deadline();
+  // Overrun by more than two periods.
+  std::this_thread::sleep_until(first_deadline + milliseconds(12));
+  EXPECT_FALSE(loop.sleep());
+
+  rcpputils::rate_loop_statistics stats = loop.statistics();
+  EXPECT_EQ(1u, stats.cycles);
+  EXPECT_EQ(1u, stats.overruns);
+  EXPECT_GE(stats.missed_cycles, 2u);
+  EXPECT_GE(stats.max_overrun, milliseconds(12));
+  EXPECT_EQ(std::chrono::nanoseconds(0), stats.mean_jitter);
+  // Skipped deadlines keep the phase of the schedule.
+  EXPECT_EQ(
+    first_deadline + milliseconds(5) * static_cast<int>(stats.missed_cycles + 1u),
+    loop.next_deadline());
+  EXPECT_GT(loop.next_deadline(), first_deadline + milliseconds(12));
+
+  loop.reset_statistics();
+  stats = loop.statistics();
+  EXPECT_EQ(0u, stats.cycles);
+  EXPECT_EQ(0u, stats.overruns);
+  EXPECT_EQ(0u, stats.missed_cycles);
+
+  const auto before_reset = std::chrono::steady_clock::now();
+  loop.reset();
+  EXPECT_GE(loop.next_deadline(), before_reset + milliseconds(5));
+}
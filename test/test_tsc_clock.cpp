@@ -0,0 +1,91 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "rcpputils/tsc_clock.hpp"
+
+using rcpputils::tsc_clock;
+
+static_assert(tsc_clock::is_steady, "tsc_clock must be steady");
+static_assert(
+  std::is_same_v<tsc_clock::duration, std::chrono::nanoseconds>,
+  "tsc_clock has nanosecond resolution");
+static_assert(
+  std::is_same_v<decltype(tsc_clock::now()), tsc_clock::time_point>,
+  "tsc_clock::now returns a time_point");
+
+TEST(test_tsc_clock, calibration) {
+  if (tsc_clock::is_counter_based()) {
+    EXPECT_GT(tsc_clock::counter_frequency(), 1e6);
+  } else {
+    EXPECT_EQ(0.0, tsc_clock::counter_frequency());
+  }
+}
+
+TEST(test_tsc_clock, monotonic) {
+  tsc_clock::time_point previous = tsc_clock::now();
+  for (int i = 0; i < 100000; ++i) {
+    const tsc_clock::time_point now = tsc_clock::now();
+    ASSERT_LE(previous, now);
+    previous = now;
+  }
+}
+
+TEST(test_tsc_clock, monotonic_in_each_thread) {
+  // Threads may be migrated between cores, whose counters may differ slightly.
+  std::vector<std::thread> threads;
+  std::vector<int> backwards(4, 0);
+  for (std::size_t t = 0; t < backwards.size(); ++t) {
+    threads.emplace_back(
+      [&backwards, t] {
+        tsc_clock::time_point previous = tsc_clock::now();
+        for (int i = 0; i < 100000; ++i) {
+          const tsc_clock::time_point now = tsc_clock::now();
+          if (now < previous) {
+            ++backwards[t];
+          }
+          previous = now;
+          if (0 == i % 1000) {
+            std::this_thread::yield();
+          }
+        }
+      });
+  }
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(std::vector<int>(backwards.size(), 0), backwards);
+}
+
+TEST(test_tsc_clock, tracks_steady_clock) {
+  // The clocks share an epoch.
+  const auto steady_start = std::chrono::steady_clock::now().time_since_epoch();
+  const auto tsc_start = tsc_clock::now().time_since_epoch();
+  EXPECT_LT(std::chrono::abs(tsc_start - steady_start), std::chrono::milliseconds(1));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  const auto steady_elapsed = std::chrono::steady_clock::now().time_since_epoch() - steady_start;
+  const auto tsc_elapsed = tsc_clock::now().time_since_epoch() - tsc_start;
+  // Allow for calibration error and for the time between reading both clocks.
+  EXPECT_LT(
+    std::chrono::abs(tsc_elapsed - steady_elapsed),
+    std::chrono::milliseconds(1) + steady_elapsed / 1000);
+}